@@ -0,0 +1,74 @@
+//scrypt logins per second per core at each cost, derived the way PasswordHasher::Derive does it.
+//one login costs one derivation, pick the ScryptLogN whose rate covers the peak login rate.
+//usage: PasswordBench [threads] [seconds] [r] [p]
+#include <openssl/evp.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+static bool Derive(int logN, int r, int p)
+{
+	static const char password[] = "correct horse battery staple";
+	static const unsigned char salt[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+	uint64_t n = 1ULL << logN;
+	uint64_t maxmem = 128ULL * r * (n + p) + (1 << 20);
+	unsigned char out[32];
+	return EVP_PBE_scrypt(password, sizeof(password) - 1, salt, sizeof(salt), n, r, p, maxmem, out, sizeof(out)) == 1;
+}
+
+//derivations per second summed over the threads
+static double Run(int threads, double seconds, int logN, int r, int p)
+{
+	atomic<bool> stop(false);
+	atomic<long long> total(0);
+	vector<thread> workers;
+	auto start = chrono::steady_clock::now();
+	for (int i = 0; i < threads; ++i)
+	{
+		workers.emplace_back([&] {
+			long long count = 0;
+			//at least one each, a slow cost may take longer than the run
+			do
+			{
+				if (!Derive(logN, r, p)) break;
+				++count;
+			} while (!stop.load(memory_order_relaxed));
+			total += count;
+		});
+	}
+	this_thread::sleep_for(chrono::duration<double>(seconds));
+	stop = true;
+	for (auto& t : workers) t.join();
+	return total / chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+	int threads = argc > 1 ? atoi(argv[1]) : (int)thread::hardware_concurrency();
+	double seconds = argc > 2 ? atof(argv[2]) : 2;
+	int r = argc > 3 ? atoi(argv[3]) : 8;
+	int p = argc > 4 ? atoi(argv[4]) : 1;
+	if (threads < 1) threads = 1;
+
+	cout << "threads " << threads << ", r=" << r << " p=" << p << ", " << seconds << " s per run" << endl;
+	for (int logN = 14; logN <= 17; ++logN)
+	{
+		double single = Run(1, seconds, logN, r, p);
+		cout << "ln=" << logN << " (" << (128ULL * r << logN >> 20) << " MiB): " << 1000 / single << " ms per login, "
+			<< single << " logins/s on one core";
+		if (threads > 1)
+		{
+			double all = Run(threads, seconds, logN, r, p);
+			cout << ", " << all << "/s on " << threads << " threads (" << all / threads << "/s per core)";
+		}
+		cout << endl;
+	}
+	return 0;
+}
@@ -0,0 +1,166 @@
+//tls handshakes per second per core on the server side, full and resumed, with the settings of
+//TlsContext::Configure. Client and server run in one thread over a memory bio pair and only the
+//time spent in the server's ssl calls is counted. usage: TlsBench [seconds]
+#include <openssl/ssl.h>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#include <openssl/ec.h>
+#include <openssl/rsa.h>
+#include <openssl/err.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+static EVP_PKEY* NewKey(bool ecdsa)
+{
+	EVP_PKEY* key = nullptr;
+	EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new_id(ecdsa ? EVP_PKEY_EC : EVP_PKEY_RSA, nullptr);
+	EVP_PKEY_keygen_init(ctx);
+	if (ecdsa) EVP_PKEY_CTX_set_ec_paramgen_curve_nid(ctx, NID_X9_62_prime256v1);
+	else EVP_PKEY_CTX_set_rsa_keygen_bits(ctx, 2048);
+	EVP_PKEY_keygen(ctx, &key);
+	EVP_PKEY_CTX_free(ctx);
+	return key;
+}
+
+static X509* NewCert(EVP_PKEY* key)
+{
+	X509* cert = X509_new();
+	X509_set_version(cert, 2);
+	ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+	X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+	X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+	X509_set_pubkey(cert, key);
+	X509_NAME* name = X509_get_subject_name(cert);
+	X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const unsigned char*)"ks-gate-bench", -1, -1, 0);
+	X509_set_issuer_name(cert, name);
+	X509_sign(cert, key, EVP_sha256());
+	return cert;
+}
+
+//same protocol, group, cipher and session settings as the gate
+static SSL_CTX* ServerContext(EVP_PKEY* key, X509* cert)
+{
+	SSL_CTX* ctx = SSL_CTX_new(TLS_server_method());
+	SSL_CTX_set_min_proto_version(ctx, TLS1_2_VERSION);
+	SSL_CTX_set1_groups_list(ctx, "X25519:P-256");
+	SSL_CTX_set_cipher_list(ctx, "ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-ECDSA-CHACHA20-POLY1305:ECDHE-ECDSA-AES256-GCM-SHA384:"
+		"ECDHE-RSA-AES128-GCM-SHA256:ECDHE-RSA-CHACHA20-POLY1305:ECDHE-RSA-AES256-GCM-SHA384");
+	SSL_CTX_set_options(ctx, SSL_OP_CIPHER_SERVER_PREFERENCE);
+	SSL_CTX_use_certificate(ctx, cert);
+	SSL_CTX_use_PrivateKey(ctx, key);
+	static const unsigned char sessionContext[] = "ks-gate";
+	SSL_CTX_set_session_id_context(ctx, sessionContext, sizeof(sessionContext) - 1);
+	SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+	SSL_CTX_set_num_tickets(ctx, 1);
+	return ctx;
+}
+
+//one connection, returns false when the handshake failed. server accumulates the server side time,
+//session is resumed when given and replaced by the one the server issued
+static bool Connect(SSL_CTX* serverCtx, SSL_CTX* clientCtx, SSL_SESSION*& session, Clock::duration& server, bool& resumed)
+{
+	SSL* s = SSL_new(serverCtx);
+	SSL* c = SSL_new(clientCtx);
+	BIO* sb;
+	BIO* cb;
+	BIO_new_bio_pair(&sb, 0, &cb, 0);
+	SSL_set_bio(s, sb, sb);
+	SSL_set_bio(c, cb, cb);
+	SSL_set_accept_state(s);
+	SSL_set_connect_state(c);
+	if (session) SSL_set_session(c, session);
+
+	bool ok = false;
+	for (int round = 0; round < 16; ++round)
+	{
+		int cr = SSL_do_handshake(c);
+		auto start = Clock::now();
+		int sr = SSL_do_handshake(s);
+		server += Clock::now() - start;
+		if (cr == 1 && sr == 1)
+		{
+			ok = true;
+			break;
+		}
+	}
+	if (ok)
+	{
+		//the tls 1.3 ticket arrives after the handshake, a byte of data carries it to the client
+		char byte = 'x';
+		auto start = Clock::now();
+		SSL_write(s, &byte, 1);
+		server += Clock::now() - start;
+		SSL_read(c, &byte, 1);
+		resumed = SSL_session_reused(s) == 1;
+		if (session) SSL_SESSION_free(session);
+		session = SSL_get1_session(c);
+	}
+	//freed without a shutdown, openssl would mark the session as not resumable
+	SSL_set_shutdown(c, SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+	SSL_set_shutdown(s, SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+	SSL_free(c);
+	SSL_free(s);
+	return ok;
+}
+
+static void Run(const string& label, SSL_CTX* serverCtx, int version, double seconds)
+{
+	SSL_CTX* clientCtx = SSL_CTX_new(TLS_client_method());
+	SSL_CTX_set_min_proto_version(clientCtx, version);
+	SSL_CTX_set_max_proto_version(clientCtx, version);
+	SSL_CTX_set_session_cache_mode(clientCtx, SSL_SESS_CACHE_CLIENT);
+	for (bool resume : { false, true })
+	{
+		SSL_SESSION* session = nullptr;
+		Clock::duration server{ 0 };
+		long long count = 0;
+		long long reused = 0;
+		auto end = Clock::now() + chrono::duration_cast<Clock::duration>(chrono::duration<double>(seconds));
+		while (Clock::now() < end)
+		{
+			bool resumed = false;
+			//full handshakes start without a session every time
+			if (!resume && session)
+			{
+				SSL_SESSION_free(session);
+				session = nullptr;
+			}
+			if (!Connect(serverCtx, clientCtx, session, server, resumed))
+			{
+				cerr << label << ": handshake failed" << endl;
+				ERR_print_errors_fp(stderr);
+				break;
+			}
+			++count;
+			if (resumed) ++reused;
+		}
+		if (session) SSL_SESSION_free(session);
+		double busy = chrono::duration<double>(server).count();
+		cout << label << (resume ? " resumed: " : " full:    ") << (long long)(count / busy) << " handshakes/s per server core, "
+			<< reused << " of " << count << " resumed" << endl;
+	}
+	SSL_CTX_free(clientCtx);
+}
+
+int main(int argc, char* argv[])
+{
+	double seconds = argc > 1 ? atof(argv[1]) : 2;
+	for (bool ecdsa : { true, false })
+	{
+		EVP_PKEY* key = NewKey(ecdsa);
+		X509* cert = NewCert(key);
+		SSL_CTX* ctx = ServerContext(key, cert);
+		string name = ecdsa ? "ecdsa p-256" : "rsa 2048";
+		Run(name + " tls1.3", ctx, TLS1_3_VERSION, seconds);
+		Run(name + " tls1.2", ctx, TLS1_2_VERSION, seconds);
+		SSL_CTX_free(ctx);
+		X509_free(cert);
+		EVP_PKEY_free(key);
+	}
+	return 0;
+}
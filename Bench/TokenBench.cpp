@@ -0,0 +1,81 @@
+//tokens per second per core: the old uuid nonce, CreatNonce from LoginToken.cpp alone, and a whole
+//signed login token as StatusServerImpl::AssignServer builds it. usage: TokenBench [threads] [seconds]
+#include "LoginToken.h"
+#include <boost/uuid/uuid.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+//the nonce before login tokens: a fresh boost generator per call seeds itself from the os every time
+static string Uuid()
+{
+	boost::uuids::uuid uuid = boost::uuids::random_generator()();
+	return boost::uuids::to_string(uuid);
+}
+
+//runs work on every thread for the given time, returns calls per second summed over the threads
+template <typename Work>
+static double Run(int threads, double seconds, Work work)
+{
+	atomic<bool> stop(false);
+	atomic<long long> total(0);
+	vector<thread> workers;
+	for (int i = 0; i < threads; ++i)
+	{
+		workers.emplace_back([&] {
+			long long count = 0;
+			while (!stop.load(memory_order_relaxed))
+			{
+				for (int j = 0; j < 256; ++j) work();
+				count += 256;
+			}
+			total += count;
+		});
+	}
+	this_thread::sleep_for(chrono::duration<double>(seconds));
+	stop = true;
+	for (auto& t : workers) t.join();
+	return total / seconds;
+}
+
+int main(int argc, char* argv[])
+{
+	int threads = argc > 1 ? atoi(argv[1]) : (int)thread::hardware_concurrency();
+	double seconds = argc > 2 ? atof(argv[2]) : 2;
+	if (threads < 1) threads = 1;
+
+	TokenKeyRing keys;
+	keys.Add(1, "bench-only-secret-bench-only-secret!");
+	auto token = [&keys] {
+		TokenClaims claims;
+		claims.uid = 1001;
+		claims.server = "127.0.0.1:9001";
+		claims.expire = chrono::duration_cast<chrono::seconds>(chrono::system_clock::now().time_since_epoch()).count() + 60;
+		claims.nonce = CreatNonce();
+		volatile size_t size = keys.Sign(claims).size();
+		(void)size;
+	};
+	auto uuid = [] { volatile size_t size = Uuid().size(); (void)size; };
+	auto nonce = [] { volatile size_t size = CreatNonce().size(); (void)size; };
+
+	cout << "threads " << threads << ", " << seconds << " s per run" << endl;
+	vector<int> runs{ 1 };
+	if (threads > 1) runs.push_back(threads);
+	for (int n : runs)
+	{
+		double uuids = Run(n, seconds, uuid);
+		double nonces = Run(n, seconds, nonce);
+		double tokens = Run(n, seconds, token);
+		cout << n << " thread(s): uuid " << (long long)uuids << "/s (" << (long long)(uuids / n) << "/s per core), "
+			<< "nonce " << (long long)nonces << "/s (" << (long long)(nonces / n) << "/s per core), "
+			<< "signed token " << (long long)tokens << "/s (" << (long long)(tokens / n) << "/s per core)" << endl;
+	}
+	return 0;
+}
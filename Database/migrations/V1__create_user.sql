@@ -0,0 +1,18 @@
+-- user accounts, uid is handed out from user_id so it never depends on insert order
+CREATE TABLE IF NOT EXISTS `user` (
+	`id` INT NOT NULL AUTO_INCREMENT,
+	`uid` INT NOT NULL,
+	`user` VARCHAR(64) NOT NULL,
+	`email` VARCHAR(128) NOT NULL,
+	`password` VARCHAR(128) NOT NULL,
+	PRIMARY KEY (`id`),
+	UNIQUE KEY `uid` (`uid`),
+	UNIQUE KEY `user` (`user`),
+	UNIQUE KEY `email` (`email`)
+) ENGINE = InnoDB DEFAULT CHARSET = utf8mb4;
+
+CREATE TABLE IF NOT EXISTS `user_id` (
+	`id` INT NOT NULL
+) ENGINE = InnoDB DEFAULT CHARSET = utf8mb4;
+
+INSERT INTO `user_id` (`id`) SELECT 0 FROM DUAL WHERE NOT EXISTS (SELECT 1 FROM `user_id`);
@@ -0,0 +1,33 @@
+-- result: new uid on success, 0 if the name or email is taken, -1 on error
+DROP PROCEDURE IF EXISTS `UserRegister`;
+
+DELIMITER $$
+CREATE PROCEDURE `UserRegister`(
+	IN `new_name` VARCHAR(64),
+	IN `new_pwd` VARCHAR(128),
+	IN `new_email` VARCHAR(128),
+	OUT `result` INT)
+BEGIN
+	DECLARE EXIT HANDLER FOR SQLEXCEPTION
+	BEGIN
+		ROLLBACK;
+		SET result = -1;
+	END;
+
+	START TRANSACTION;
+	IF EXISTS (SELECT 1 FROM `user` WHERE `user` = new_name) THEN
+		SET result = 0;
+		COMMIT;
+	ELSEIF EXISTS (SELECT 1 FROM `user` WHERE `email` = new_email) THEN
+		SET result = 0;
+		COMMIT;
+	ELSE
+		UPDATE `user_id` SET `id` = `id` + 1;
+		SELECT `id` INTO @new_id FROM `user_id`;
+		INSERT INTO `user` (`uid`, `user`, `email`, `password`)
+		VALUES (@new_id, new_name, new_email, new_pwd);
+		SET result = @new_id;
+		COMMIT;
+	END IF;
+END$$
+DELIMITER ;
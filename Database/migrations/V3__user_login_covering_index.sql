@@ -0,0 +1,3 @@
+-- covers the login query (SELECT uid, password, email FROM user WHERE user = ?)
+-- so it is answered from the index without reading the clustered row
+ALTER TABLE `user` ADD INDEX `idx_user_login` (`user`, `uid`, `password`, `email`);
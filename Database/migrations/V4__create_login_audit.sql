@@ -0,0 +1,10 @@
+-- one row per /login attempt, filled in batches by GateServer's AuditWriter
+CREATE TABLE IF NOT EXISTS `login_audit` (
+	`id` BIGINT NOT NULL AUTO_INCREMENT,
+	`uid` INT NOT NULL,
+	`ip` VARCHAR(45) NOT NULL,
+	`time` DATETIME(3) NOT NULL,
+	`result` INT NOT NULL,
+	PRIMARY KEY (`id`),
+	KEY `idx_login_audit_uid` (`uid`, `time`)
+) ENGINE = InnoDB DEFAULT CHARSET = utf8mb4;
@@ -0,0 +1,32 @@
+-- UserRegister without the existence checks, GateServer calls it for names its filter
+-- has never seen. result: new uid on success, 0 if the unique keys reject the row, -1 on error
+DROP PROCEDURE IF EXISTS `UserInsert`;
+
+DELIMITER $$
+CREATE PROCEDURE `UserInsert`(
+	IN `new_name` VARCHAR(64),
+	IN `new_pwd` VARCHAR(128),
+	IN `new_email` VARCHAR(128),
+	OUT `result` INT)
+BEGIN
+	DECLARE EXIT HANDLER FOR SQLEXCEPTION
+	BEGIN
+		ROLLBACK;
+		SET result = -1;
+	END;
+	-- duplicate key, the name or email is taken after all
+	DECLARE EXIT HANDLER FOR 1062
+	BEGIN
+		ROLLBACK;
+		SET result = 0;
+	END;
+
+	START TRANSACTION;
+	UPDATE `user_id` SET `id` = `id` + 1;
+	SELECT `id` INTO @new_id FROM `user_id`;
+	INSERT INTO `user` (`uid`, `user`, `email`, `password`)
+	VALUES (@new_id, new_name, new_email, new_pwd);
+	SET result = @new_id;
+	COMMIT;
+END$$
+DELIMITER ;
@@ -0,0 +1,282 @@
+#include "AsyncRedis.h"
+#include "ioContextPool.h"
+#include "RedisManager.h"
+#include <iostream>
+#include <hiredis/hiredis.h>
+#include <hiredis/async.h>
+
+using namespace std;
+namespace asio = boost::asio;
+using tcp = asio::ip::tcp;
+
+static RedisReply Convert(const redisReply* reply)
+{
+	RedisReply res;
+	switch (reply->type)
+	{
+	case REDIS_REPLY_STRING: res.type = RedisReply::String; break;
+	case REDIS_REPLY_STATUS: res.type = RedisReply::Status; break;
+	case REDIS_REPLY_ERROR: res.type = RedisReply::Error; break;
+	case REDIS_REPLY_INTEGER: res.type = RedisReply::Integer; break;
+	case REDIS_REPLY_ARRAY: res.type = RedisReply::Array; break;
+	default: res.type = RedisReply::Nil; break;
+	}
+	if (reply->str) res.str.assign(reply->str, reply->len);
+	res.integer = reply->integer;
+	for (size_t i = 0; i < reply->elements; ++i)
+	{
+		res.elements.push_back(Convert(reply->element[i]));
+	}
+	return res;
+}
+
+//one hiredis async connection whose socket events are waited on by asio
+class AsyncRedis::Link
+{
+public:
+	Link(asio::io_context& ioc, const sw::redis::ConnectionOptions& options)
+		:options_(options),
+		socket_(ioc),
+		ctx_(nullptr),
+		wantRead_(false),
+		wantWrite_(false),
+		reading_(false),
+		writing_(false)
+	{}
+
+	~Link()
+	{
+		//pending callbacks are completed with an error by hiredis
+		if (ctx_) redisAsyncFree(ctx_);
+	}
+
+	void Command(const vector<string>& argv, Callback callback)
+	{
+		if (!ctx_ && !Connect())
+		{
+			Fail(move(callback));
+			return;
+		}
+		vector<const char*> args;
+		vector<size_t> lens;
+		for (auto& arg : argv)
+		{
+			args.push_back(arg.data());
+			lens.push_back(arg.size());
+		}
+		auto* data = new Callback(move(callback));
+		if (redisAsyncCommandArgv(ctx_, &Link::OnReply, data, (int)args.size(), args.data(), lens.data()) != REDIS_OK)
+		{
+			Fail(move(*data));
+			delete data;
+		}
+	}
+private:
+	//never complete inline, the caller may still be setting up
+	void Fail(Callback callback)
+	{
+		asio::post(socket_.get_executor(), [callback = move(callback)]() {
+			callback(asio::error::not_connected, RedisReply());
+			});
+	}
+
+	bool Connect()
+	{
+		ctx_ = redisAsyncConnect(options_.host.c_str(), options_.port);
+		if (!ctx_ || ctx_->err)
+		{
+			//TODO use log to print
+			cerr << "AsyncRedis connect " << options_.host << ":" << options_.port << " failed\n";
+			if (ctx_) redisAsyncFree(ctx_);
+			ctx_ = nullptr;
+			return false;
+		}
+		boost::system::error_code ec;
+		socket_.assign(tcp::v4(), ctx_->c.fd, ec);
+		if (ec)
+		{
+			redisAsyncFree(ctx_);
+			ctx_ = nullptr;
+			return false;
+		}
+		ctx_->data = this;
+		ctx_->ev.data = this;
+		ctx_->ev.addRead = [](void* p) { static_cast<Link*>(p)->wantRead_ = true; static_cast<Link*>(p)->WaitRead(); };
+		ctx_->ev.delRead = [](void* p) { static_cast<Link*>(p)->wantRead_ = false; };
+		ctx_->ev.addWrite = [](void* p) { static_cast<Link*>(p)->wantWrite_ = true; static_cast<Link*>(p)->WaitWrite(); };
+		ctx_->ev.delWrite = [](void* p) { static_cast<Link*>(p)->wantWrite_ = false; };
+		ctx_->ev.cleanup = [](void* p) { static_cast<Link*>(p)->Cleanup(); };
+		redisAsyncSetConnectCallback(ctx_, &Link::OnConnect);
+		redisAsyncSetDisconnectCallback(ctx_, &Link::OnDisconnect);
+		//commands issued before the connect completes are buffered by hiredis
+		if (!options_.password.empty())
+		{
+			redisAsyncCommand(ctx_, nullptr, nullptr, "AUTH %b", options_.password.data(), options_.password.size());
+		}
+		return true;
+	}
+
+	void WaitRead()
+	{
+		if (reading_ || !wantRead_ || !ctx_) return;
+		reading_ = true;
+		socket_.async_wait(tcp::socket::wait_read, [this](boost::system::error_code ec) {
+			reading_ = false;
+			if (ctx_ && ec != asio::error::operation_aborted) redisAsyncHandleRead(ctx_);
+			WaitRead();
+			});
+	}
+
+	void WaitWrite()
+	{
+		if (writing_ || !wantWrite_ || !ctx_) return;
+		writing_ = true;
+		socket_.async_wait(tcp::socket::wait_write, [this](boost::system::error_code ec) {
+			writing_ = false;
+			if (ctx_ && ec != asio::error::operation_aborted) redisAsyncHandleWrite(ctx_);
+			WaitWrite();
+			});
+	}
+
+	//hiredis closes the fd itself, asio must only let go of it
+	void Cleanup()
+	{
+		wantRead_ = wantWrite_ = false;
+		boost::system::error_code ec;
+		if (socket_.is_open()) socket_.release(ec);
+		ctx_ = nullptr;
+	}
+
+	static void OnReply(redisAsyncContext* ctx, void* reply, void* privdata)
+	{
+		unique_ptr<Callback> callback(static_cast<Callback*>(privdata));
+		if (!reply) (*callback)(asio::error::connection_aborted, RedisReply());
+		else (*callback)(boost::system::error_code(), Convert(static_cast<redisReply*>(reply)));
+	}
+
+	static void OnConnect(const redisAsyncContext* ctx, int status)
+	{
+		if (status == REDIS_OK) return;
+		//TODO use log to print
+		cerr << "AsyncRedis connect failed: " << ctx->errstr << endl;
+	}
+
+	//the next command reconnects
+	static void OnDisconnect(const redisAsyncContext* ctx, int status)
+	{
+		if (status != REDIS_OK) cerr << "AsyncRedis disconnected: " << ctx->errstr << endl;
+	}
+
+	sw::redis::ConnectionOptions options_;
+	tcp::socket socket_;
+	redisAsyncContext* ctx_;
+	bool wantRead_;
+	bool wantWrite_;
+	bool reading_;
+	bool writing_;
+};
+
+AsyncRedis::AsyncRedis()
+	:links_(ioContextPool::Instance().size()),
+	next_(0)
+{
+	for (auto& links : links_)
+	{
+		links.resize(RedisManager::Instance().NodeCount());
+	}
+}
+
+AsyncRedis::~AsyncRedis() = default;
+
+void AsyncRedis::Command(const std::string& key, std::vector<std::string> argv, Callback callback)
+{
+	Dispatch(key, [argv = move(argv), callback = move(callback)](Link& link) mutable {
+		link.Command(argv, move(callback));
+	});
+}
+
+void AsyncRedis::NodeCommand(std::size_t node, std::vector<std::string> argv, Callback callback)
+{
+	Dispatch(node, [argv = move(argv), callback = move(callback)](Link& link) mutable {
+		link.Command(argv, move(callback));
+	});
+}
+
+void AsyncRedis::Get(const std::string& key, Callback callback)
+{
+	Command(key, { "GET", key }, move(callback));
+}
+
+void AsyncRedis::Set(const std::string& key, const std::string& value, std::chrono::milliseconds ttl, Callback callback)
+{
+	if (ttl.count() > 0) Command(key, { "SET", key, value, "PX", to_string(ttl.count()) }, move(callback));
+	else Command(key, { "SET", key, value }, move(callback));
+}
+
+void AsyncRedis::Eval(const std::string& script, std::vector<std::string> keys, std::vector<std::string> args, Callback callback)
+{
+	//the script runs on the node of its first key
+	string route = keys.empty() ? string() : keys.front();
+	vector<string> argv{ "EVAL", script, to_string(keys.size()) };
+	argv.insert(argv.end(), make_move_iterator(keys.begin()), make_move_iterator(keys.end()));
+	argv.insert(argv.end(), make_move_iterator(args.begin()), make_move_iterator(args.end()));
+	Command(route, move(argv), move(callback));
+}
+
+void AsyncRedis::Pipeline(const std::string& key, std::vector<std::vector<std::string>> commands, PipelineCallback callback)
+{
+	if (commands.empty())
+	{
+		callback(boost::system::error_code(), vector<RedisReply>());
+		return;
+	}
+	struct State
+	{
+		vector<RedisReply> replies;
+		size_t left;
+		boost::system::error_code ec;
+		PipelineCallback callback;
+	};
+	auto state = make_shared<State>();
+	state->replies.resize(commands.size());
+	state->left = commands.size();
+	state->callback = move(callback);
+	//every reply arrives on the same io thread, no locking needed
+	Dispatch(key, [commands = move(commands), state](Link& link) {
+		for (size_t i = 0; i < commands.size(); ++i)
+		{
+			link.Command(commands[i], [state, i](boost::system::error_code ec, RedisReply reply) {
+				if (ec) state->ec = ec;
+				state->replies[i] = move(reply);
+				if (--state->left == 0) state->callback(state->ec, move(state->replies));
+			});
+		}
+	});
+}
+
+void AsyncRedis::Dispatch(const std::string& key, std::function<void(Link&)> task)
+{
+	Dispatch(RedisManager::Instance().NodeIndex(key), move(task));
+}
+
+void AsyncRedis::Dispatch(std::size_t node, std::function<void(Link&)> task)
+{
+	int index = ioContextPool::CurrentIndex();
+	if (index >= 0)
+	{
+		task(LinkOf(index, node));
+		return;
+	}
+	//not an io thread, hand the command to one
+	index = (int)(next_++ % links_.size());
+	asio::post(ioContextPool::Instance().Context(index), [this, index, node, task = move(task)]() {
+		task(LinkOf(index, node));
+	});
+}
+
+AsyncRedis::Link& AsyncRedis::LinkOf(int index, std::size_t node)
+{
+	auto& link = links_[index][node];
+	if (!link) link.reset(new Link(ioContextPool::Instance().Context(index), RedisManager::Instance().NodeOptions(node)));
+	return *link;
+}
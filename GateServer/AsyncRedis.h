@@ -0,0 +1,52 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <atomic>
+#include <chrono>
+#include <boost/asio.hpp>
+#include "Singleton.ipp"
+
+struct RedisReply
+{
+	enum Type { Nil, String, Integer, Array, Status, Error };
+	Type type = Nil;
+	std::string str;
+	long long integer = 0;
+	std::vector<RedisReply> elements;
+};
+
+//non blocking redis commands driven by the ioContextPool contexts through hiredis,
+//every io thread owns one connection per redis node. Callbacks run on the io thread
+//that issued the command, calls from other threads are posted to a pool context.
+//ec is set when the connection failed, error replies come back as RedisReply::Error
+class AsyncRedis : public Singleton<AsyncRedis>
+{
+	friend class Singleton<AsyncRedis>;
+public:
+	using Callback = std::function<void(boost::system::error_code, RedisReply)>;
+	using PipelineCallback = std::function<void(boost::system::error_code, std::vector<RedisReply>)>;
+
+	~AsyncRedis();
+	//argv is sent to the node owning key
+	void Command(const std::string& key, std::vector<std::string> argv, Callback callback);
+	//argv is sent to the given node whatever the keys, for keys pinned outside the ring
+	void NodeCommand(std::size_t node, std::vector<std::string> argv, Callback callback);
+	void Get(const std::string& key, Callback callback);
+	void Set(const std::string& key, const std::string& value, std::chrono::milliseconds ttl, Callback callback);
+	void Eval(const std::string& script, std::vector<std::string> keys, std::vector<std::string> args, Callback callback);
+	//all commands go out back to back on one connection
+	void Pipeline(const std::string& key, std::vector<std::vector<std::string>> commands, PipelineCallback callback);
+private:
+	class Link;
+
+	AsyncRedis();
+	void Dispatch(const std::string& key, std::function<void(Link&)> task);
+	void Dispatch(std::size_t node, std::function<void(Link&)> task);
+	Link& LinkOf(int index, std::size_t node);
+
+	//links_[io context][redis node], only touched by that context's thread
+	std::vector<std::vector<std::unique_ptr<Link>>> links_;
+	std::atomic<std::size_t> next_;
+};
@@ -0,0 +1,92 @@
+#include "AuditWriter.h"
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+using namespace std::chrono;
+
+static const char* SpillFile = "login_audit.spill";
+
+AuditWriter::AuditWriter(size_t capacity, size_t batch, milliseconds delay)
+	:queue_(capacity),
+	batch_(batch),
+	delay_(delay),
+	running_(true),
+	dropped_(0)
+{
+	//make sure the dao outlives the writer thread
+	MysqlDao::Instance();
+	thread_ = thread([this] { run(); });
+}
+
+AuditWriter::~AuditWriter()
+{
+	running_ = false;
+	if (thread_.joinable()) thread_.join();
+}
+
+void AuditWriter::Record(int uid, const std::string& ip, int result)
+{
+	long long now = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+	if (!queue_.push(LoginAudit{ uid, ip, now, result })) ++dropped_;
+}
+
+size_t AuditWriter::Dropped() const
+{
+	return dropped_;
+}
+
+void AuditWriter::run()
+{
+	vector<LoginAudit> batch;
+	batch.reserve(batch_);
+	auto first = steady_clock::now();
+	LoginAudit audit;
+	while (running_)
+	{
+		bool got = false;
+		while (batch.size() < batch_ && queue_.pop(audit))
+		{
+			if (batch.empty()) first = steady_clock::now();
+			batch.push_back(move(audit));
+			got = true;
+		}
+		if (batch.size() >= batch_ || (!batch.empty() && steady_clock::now() - first >= delay_))
+		{
+			flush(batch);
+		}
+		else if (!got)
+		{
+			this_thread::sleep_for(milliseconds(10));
+		}
+	}
+	//drain what is left on shutdown
+	while (queue_.pop(audit))
+	{
+		batch.push_back(move(audit));
+		if (batch.size() >= batch_) flush(batch);
+	}
+	flush(batch);
+}
+
+void AuditWriter::flush(std::vector<LoginAudit>& batch)
+{
+	if (batch.empty()) return;
+	if (!MysqlDao::Instance().InsertLoginAudits(batch)) spill(batch);
+	batch.clear();
+}
+
+void AuditWriter::spill(const std::vector<LoginAudit>& batch)
+{
+	ofstream file(SpillFile, ios::app);
+	if (!file)
+	{
+		//TODO use log to print
+		cerr << "AuditWriter lost " << batch.size() << " rows\n";
+		return;
+	}
+	for (auto& audit : batch)
+	{
+		file << audit.uid << ',' << audit.ip << ',' << audit.time << ',' << audit.result << '\n';
+	}
+}
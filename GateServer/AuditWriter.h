@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include "Singleton.ipp"
+#include "LockFreeQueue.h"
+#include "MysqlDao.h"
+
+//collects login audit rows from the io threads and writes them in batches
+//Record() is a single lock free push, rows are dropped when the queue is full
+//and spilled to a local file when MySQL rejects a batch
+class AuditWriter : public Singleton<AuditWriter>
+{
+	friend class Singleton<AuditWriter>;
+public:
+	~AuditWriter();
+	void Record(int uid, const std::string& ip, int result);
+	size_t Dropped() const;
+private:
+	AuditWriter(size_t capacity = 4096, size_t batch = 128, std::chrono::milliseconds delay = std::chrono::milliseconds(500));
+	void run();
+	void flush(std::vector<LoginAudit>& batch);
+	void spill(const std::vector<LoginAudit>& batch);
+
+	LockFreeQueue<LoginAudit> queue_;
+	size_t batch_;
+	std::chrono::milliseconds delay_;
+	std::atomic_bool running_;
+	std::atomic<size_t> dropped_;
+	std::thread thread_;
+};
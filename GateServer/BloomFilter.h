@@ -0,0 +1,73 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <functional>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+//fixed size bloom filter, Add and MayContain are lock free and safe from any thread.
+//false means the key was never added, true may be wrong at about the configured rate
+class BloomFilter
+{
+public:
+	BloomFilter(size_t expected, double falsePositive)
+	{
+		if (expected < 1) expected = 1;
+		if (falsePositive <= 0 || falsePositive >= 1) falsePositive = 0.01;
+		//m = -n ln p / (ln 2)^2, k = m / n ln 2
+		double bits = -(double)expected * std::log(falsePositive) / (std::log(2.0) * std::log(2.0));
+		words_ = ((size_t)bits + 63) / 64;
+		hashes_ = (int)std::round(bits / expected * std::log(2.0));
+		if (hashes_ < 1) hashes_ = 1;
+		bits_.reset(new std::atomic<uint64_t>[words_]);
+		for (size_t i = 0; i < words_; ++i)
+		{
+			bits_[i].store(0, std::memory_order_relaxed);
+		}
+	}
+
+	BloomFilter(const BloomFilter&) = delete;
+	BloomFilter& operator= (const BloomFilter&) = delete;
+
+	void Add(const std::string& key)
+	{
+		uint64_t h1, h2;
+		Hash(key, h1, h2);
+		for (int i = 0; i < hashes_; ++i)
+		{
+			uint64_t bit = (h1 + i * h2) % (words_ * 64);
+			bits_[bit / 64].fetch_or(1ULL << (bit % 64), std::memory_order_relaxed);
+		}
+	}
+
+	bool MayContain(const std::string& key) const
+	{
+		uint64_t h1, h2;
+		Hash(key, h1, h2);
+		for (int i = 0; i < hashes_; ++i)
+		{
+			uint64_t bit = (h1 + i * h2) % (words_ * 64);
+			if (!(bits_[bit / 64].load(std::memory_order_relaxed) & (1ULL << (bit % 64)))) return false;
+		}
+		return true;
+	}
+
+	size_t Bytes() const { return words_ * 8; }
+private:
+	//two independent hashes combined as h1 + i * h2 (Kirsch-Mitzenmacher)
+	static void Hash(const std::string& key, uint64_t& h1, uint64_t& h2)
+	{
+		h1 = std::hash<std::string>()(key);
+		//splitmix64 finalizer
+		uint64_t z = h1 + 0x9e3779b97f4a7c15ULL;
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		h2 = (z ^ (z >> 31)) | 1;
+	}
+
+	std::unique_ptr<std::atomic<uint64_t>[]> bits_;
+	size_t words_;
+	int hashes_;
+};
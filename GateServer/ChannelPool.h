@@ -0,0 +1,277 @@
+#pragma once
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/alarm.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <cstdint>
+#include "RpcPoller.h"
+#include "RpcGuard.h"
+
+enum class ChannelPick
+{
+	RoundRobin,
+	FewestInFlight,
+};
+
+struct ChannelStats
+{
+	int inFlight;
+	uint64_t completed;
+	uint64_t failed;
+};
+
+//several channels to one backend, each with its own http2 connection, so the calls
+//of all io threads are not squeezed into the stream limit of a single connection.
+//every call gets the policy deadline and is refused while the breaker is open
+template<class Service>
+class ChannelPool
+{
+public:
+	using Stub = typename Service::Stub;
+	template<class Res>
+	using Prepare = std::function<std::unique_ptr<grpc::ClientAsyncResponseReader<Res>>(Stub&, grpc::ClientContext*, grpc::CompletionQueue*)>;
+	template<class Res>
+	using Done = std::function<void(const grpc::Status&, Res&)>;
+
+	ChannelPool(const std::string& address, int size, ChannelPick pick, const RpcPolicy& policy)
+		:pick_(pick),
+		next_(0),
+		policy_(policy),
+		breaker_(policy.breakerFailures, policy.breakerCooldown)
+	{
+		if (size < 1) size = 1;
+		for (int i = 0; i < size; ++i)
+		{
+			grpc::ChannelArguments args;
+			//channels with equal args share one subchannel, the index keeps them apart
+			args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+			args.SetInt("ks.channel_index", i);
+			auto entry = std::make_unique<Entry>();
+			entry->channel = grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args);
+			entry->stub = Service::NewStub(entry->channel);
+			entries_.push_back(std::move(entry));
+		}
+	}
+
+	ChannelPool(const ChannelPool&) = delete;
+	ChannelPool& operator= (const ChannelPool&) = delete;
+
+	//"round_robin" or "fewest_in_flight"
+	static ChannelPick ParsePick(const std::string& name)
+	{
+		return name == "fewest_in_flight" ? ChannelPick::FewestInFlight : ChannelPick::RoundRobin;
+	}
+
+	//reserves a channel other than avoid for one call, every Acquire is paired with a Release
+	size_t Acquire(size_t avoid = SIZE_MAX)
+	{
+		size_t count = entries_.size();
+		size_t start = next_.fetch_add(1, std::memory_order_relaxed);
+		size_t index = SIZE_MAX;
+		int best = 0;
+		//scan from a rotating start so ties do not all land on the first channel
+		for (size_t i = 0; i < count; ++i)
+		{
+			size_t candidate = (start + i) % count;
+			if (candidate == avoid && count > 1) continue;
+			int load = entries_[candidate]->inFlight.load(std::memory_order_relaxed);
+			if (index == SIZE_MAX || load < best)
+			{
+				index = candidate;
+				best = load;
+			}
+			if (pick_ == ChannelPick::RoundRobin || best == 0) break;
+		}
+		entries_[index]->inFlight.fetch_add(1, std::memory_order_relaxed);
+		return index;
+	}
+
+	void Release(size_t index, bool ok)
+	{
+		Entry& entry = *entries_[index];
+		entry.inFlight.fetch_sub(1, std::memory_order_relaxed);
+		if (ok) entry.completed.fetch_add(1, std::memory_order_relaxed);
+		else entry.failed.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	Stub& GetStub(size_t index) { return *entries_[index]->stub; }
+	size_t size() const { return entries_.size(); }
+
+	//async call driven by the RpcPoller, done runs once on a poller thread
+	template<class Res>
+	void AsyncCall(Prepare<Res> prepare, Done<Res> done)
+	{
+		if (!breaker_.Allow())
+		{
+			Res res;
+			done(grpc::Status(grpc::StatusCode::UNAVAILABLE, "circuit open"), res);
+			return;
+		}
+		(new HedgedCall<Res>(*this, std::move(prepare), std::move(done)))->Start();
+	}
+
+	std::vector<ChannelStats> Stats() const
+	{
+		std::vector<ChannelStats> stats;
+		for (auto& entry : entries_)
+		{
+			stats.push_back(ChannelStats{ entry->inFlight.load(std::memory_order_relaxed),
+				entry->completed.load(std::memory_order_relaxed),
+				entry->failed.load(std::memory_order_relaxed) });
+		}
+		return stats;
+	}
+	bool IsOpen() const { return breaker_.IsOpen(); }
+	std::chrono::microseconds P95() { return latency_.P95(); }
+private:
+	struct alignas(64) Entry
+	{
+		std::shared_ptr<grpc::Channel> channel;
+		std::unique_ptr<Stub> stub;
+		std::atomic<int> inFlight{ 0 };
+		std::atomic<uint64_t> completed{ 0 };
+		std::atomic<uint64_t> failed{ 0 };
+	};
+
+	//one logical call: the first attempt, and with hedging a second one on another channel
+	//once the first runs past p95. The first attempt to succeed answers, the other is cancelled
+	template<class Res>
+	class HedgedCall
+	{
+	public:
+		HedgedCall(ChannelPool& pool, Prepare<Res> prepare, Done<Res> done)
+			:pool_(pool),
+			prepare_(std::move(prepare)),
+			done_(std::move(done)),
+			cq_(RpcPoller::Instance().Queue()),
+			deadline_(std::chrono::system_clock::now() + pool.policy_.deadline),
+			start_(std::chrono::steady_clock::now()),
+			timer_(this)
+		{
+		}
+
+		void Start()
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			//held until the call is set up, completions may arrive before that
+			++pending_;
+			Launch(SIZE_MAX);
+			auto p95 = pool_.latency_.P95();
+			auto hedgeAt = std::chrono::system_clock::now() + p95;
+			if (pool_.policy_.hedge && pool_.size() > 1 && p95.count() > 0 && hedgeAt < deadline_)
+			{
+				++pending_;
+				alarm_.Set(cq_, hedgeAt, &timer_);
+			}
+			Release(lock);
+		}
+	private:
+		struct Attempt : public RpcCall
+		{
+			Attempt(HedgedCall* owner, size_t index) :owner(owner), index(index) {}
+			void Done(bool ok) override { owner->Finished(this, ok); }
+
+			HedgedCall* owner;
+			size_t index;
+			grpc::ClientContext context;
+			Res res;
+			grpc::Status status;
+			std::unique_ptr<grpc::ClientAsyncResponseReader<Res>> reader;
+		};
+
+		struct Timer : public RpcCall
+		{
+			explicit Timer(HedgedCall* owner) :owner(owner) {}
+			//ok is false when the alarm was cancelled
+			void Done(bool ok) override { owner->HedgeDue(ok); }
+
+			HedgedCall* owner;
+		};
+
+		void Launch(size_t avoid)
+		{
+			auto attempt = std::make_unique<Attempt>(this, pool_.Acquire(avoid));
+			attempt->context.set_deadline(deadline_);
+			attempt->reader = prepare_(pool_.GetStub(attempt->index), &attempt->context, cq_);
+			attempt->reader->StartCall();
+			attempt->reader->Finish(&attempt->res, &attempt->status, attempt.get());
+			++pending_;
+			++running_;
+			attempts_.push_back(std::move(attempt));
+		}
+
+		void HedgeDue(bool ok)
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			if (ok && !finished_) Launch(attempts_.front()->index);
+			Release(lock);
+		}
+
+		void Finished(Attempt* attempt, bool ok)
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			--running_;
+			if (!ok) attempt->status = grpc::Status(grpc::StatusCode::CANCELLED, "completion queue shut down");
+			pool_.Release(attempt->index, attempt->status.ok());
+			//a failed attempt waits for the other one if it is still running
+			if (!finished_ && (attempt->status.ok() || running_ == 0))
+			{
+				finished_ = true;
+				alarm_.Cancel();
+				for (auto& other : attempts_)
+				{
+					if (other.get() != attempt) other->context.TryCancel();
+				}
+				pool_.Finish(attempt->status, start_);
+				done_(attempt->status, attempt->res);
+			}
+			Release(lock);
+		}
+
+		//drops one pending tag, the last one frees the call
+		void Release(std::unique_lock<std::mutex>& lock)
+		{
+			bool last = --pending_ == 0;
+			lock.unlock();
+			if (last) delete this;
+		}
+
+		ChannelPool& pool_;
+		Prepare<Res> prepare_;
+		Done<Res> done_;
+		grpc::CompletionQueue* cq_;
+		std::chrono::system_clock::time_point deadline_;
+		std::chrono::steady_clock::time_point start_;
+		std::vector<std::unique_ptr<Attempt>> attempts_;
+		grpc::Alarm alarm_;
+		Timer timer_;
+		std::mutex mutex_;
+		int pending_ = 0;
+		int running_ = 0;
+		bool finished_ = false;
+	};
+
+	void Finish(const grpc::Status& status, std::chrono::steady_clock::time_point start)
+	{
+		//a call refused by the backend still shows it is alive
+		bool ok = status.error_code() != grpc::StatusCode::DEADLINE_EXCEEDED
+			&& status.error_code() != grpc::StatusCode::UNAVAILABLE;
+		breaker_.Record(ok);
+		if (status.ok())
+		{
+			latency_.Record(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+		}
+	}
+
+	std::vector<std::unique_ptr<Entry>> entries_;
+	ChannelPick pick_;
+	std::atomic<size_t> next_;
+	RpcPolicy policy_;
+	CircuitBreaker breaker_;
+	LatencyTracker latency_;
+};
@@ -1,8 +1,14 @@
 #include "Connection.h"
 #include "LogicSystem.h"
+#include "Throttle.h"
+#include "TlsContext.h"
+#include "ErrorCodes.h"
+#include <json/json.h>
 
-Connection::Connection(asio::io_context &ioc) :socket_(ioc)
-{}
+Connection::Connection(asio::io_context &ioc, asio::ssl::context* tls) :socket_(ioc)
+{
+	if (tls) tls_ = std::make_unique<asio::ssl::stream<tcp::socket&>>(socket_, *tls);
+}
 
 Connection::~Connection()
 {
@@ -11,19 +17,45 @@ Connection::~Connection()
 
 void Connection::start()
 {
+	//the deadline covers the handshake too, a client that never finishes it is closed like a slow one.
+	//counted from the accept, the connection may have been waiting for one for a while
+	timer_.expires_after(std::chrono::seconds(30));
+	CheckTime();
+	if (!tls_)
+	{
+		Read();
+		return;
+	}
 	auto self = shared_from_this();
-	http::async_read(socket_, buffer_, request_, [self](beast::error_code ec, std::size_t bytes) {
-		try {
-			if (ec) {
-				std::cout << self->socket_.remote_endpoint().address() << "Read: " << ec.message();
-				return;
-			}
-			self->HandleRequest();
-			self->CheckTime();
-		}
-		catch (std::exception& e) {
-			std::cout << self->socket_.remote_endpoint().address() << "Read: " << e.what() << std::endl;
+	tls_->async_handshake(asio::ssl::stream_base::server, [self](beast::error_code ec) {
+		if (ec) {
+			//Debug
+			std::cout << "Handshake: " << ec.message() << std::endl;
+			self->timer_.cancel();
+			return;
 		}
+		TlsContext::Instance().Handshaked(SSL_session_reused(self->tls_->native_handle()) == 1);
+		self->Read();
+		});
+}
+
+void Connection::Read()
+{
+	auto self = shared_from_this();
+	WithStream([this, self](auto& stream) {
+		http::async_read(stream, buffer_, request_, [self](beast::error_code ec, std::size_t bytes) {
+			try {
+				if (ec) {
+					std::cout << self->socket_.remote_endpoint().address() << "Read: " << ec.message();
+					self->timer_.cancel();
+					return;
+				}
+				self->HandleRequest();
+			}
+			catch (std::exception& e) {
+				std::cout << self->socket_.remote_endpoint().address() << "Read: " << e.what() << std::endl;
+			}
+			});
 		});
 }
 
@@ -42,8 +74,19 @@ http::response<http::dynamic_body>& Connection::response()
 	return response_;
 }
 
+void Connection::DeferResponse()
+{
+	deferred_ = true;
+}
+
 void Connection::HandleRequest()
 {
+	//root span of the request, ended when the response is written
+	auto& tracer = Tracer::Instance();
+	std::string name(request_.method_string().data(), request_.method_string().size());
+	name.append(" ").append(request_.target().data(), request_.target().size());
+	span_ = tracer.Start(tracer.Begin(), name, SpanKind::Server);
+	TraceScope scope(span_.context);
 	//ûӦ汾
 	response_.version(request_.version());
 	//Ϊ
@@ -63,10 +106,15 @@ void Connection::HandleRequest()
 		{
 			response_.result(http::status::ok);
 		}
-		SendResponse();
+		if (!deferred_) SendResponse();
 	}
 	else if (request_.method() == http::verb::post)
 	{
+		if (!Admit())
+		{
+			SendResponse();
+			return;
+		}
 		bool success = LogicSystem::Instance().PostHandle(request_.target(), shared_from_this());
 		response_.set(http::field::server, "MyServer");
 		if (!success)
@@ -79,10 +127,34 @@ void Connection::HandleRequest()
 		{
 			response_.result(http::status::ok);
 		}
-		SendResponse();
+		if (!deferred_) SendResponse();
 	}
 }
 
+bool Connection::Admit()
+{
+	std::string path(request_.target().data(), request_.target().size());
+	auto field = Throttle::Instance().AccountField(path);
+	if (!field) return true;
+	boost::system::error_code ec;
+	std::string ip = socket_.remote_endpoint(ec).address().to_string();
+	//the handler parses the body again, this only needs the account
+	Json::Value request;
+	Json::Reader reader;
+	std::string account;
+	if (reader.parse(beast::buffers_to_string(request_.body().data()), request)) account = request[*field].asString();
+	if (Throttle::Instance().Allow(path, ip, account)) return true;
+
+	response_.result(http::status::too_many_requests);
+	response_.set(http::field::server, "MyServer");
+	response_.set(http::field::content_type, "text/json");
+	response_.set(http::field::retry_after, std::to_string(Throttle::Instance().RetryAfter()));
+	Json::Value response;
+	response["error"] = ErrorCodes::TooManyRequests;
+	beast::ostream(response_.body()) << response.toStyledString();
+	return false;
+}
+
 void Connection::CheckTime()
 {
 	auto self = shared_from_this();
@@ -99,8 +171,19 @@ void Connection::SendResponse()
 {
 	auto self = shared_from_this();
 	response_.content_length(response_.body().size());
-	http::async_write(socket_, response_, [self](beast::error_code ec, std::size_t bytes) {
-		self->socket_.shutdown(tcp::socket::shutdown_send, ec);
-		self->timer_.cancel();
+	Tracer::Instance().End(span_, response_.result_int() >= 400 ? std::to_string(response_.result_int()) : "");
+	WithStream([this, self](auto& stream) {
+		http::async_write(stream, response_, [self](beast::error_code ec, std::size_t bytes) {
+			if (self->tls_) {
+				//close_notify keeps the session resumable for tls 1.2 clients
+				self->tls_->async_shutdown([self](beast::error_code ec) {
+					self->socket_.shutdown(tcp::socket::shutdown_send, ec);
+					self->timer_.cancel();
+					});
+				return;
+			}
+			self->socket_.shutdown(tcp::socket::shutdown_send, ec);
+			self->timer_.cancel();
+			});
 		});
 }
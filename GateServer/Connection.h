@@ -1,6 +1,9 @@
 #pragma once
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
+#include <boost/asio/ssl.hpp>
+#include <memory>
+#include "Tracer.h"
 #include <iostream>
 
 namespace asio = boost::asio;
@@ -11,21 +14,39 @@ using tcp = boost::asio::ip::tcp;
 class Connection :public std::enable_shared_from_this<Connection>
 {
 public:
-	Connection(asio::io_context &ioc);
+	//with a tls context the connection handshakes before reading the request
+	Connection(asio::io_context &ioc, asio::ssl::context* tls = nullptr);
 
 	~Connection();
 	void start();
 	tcp::socket& socket();
 	http::request<http::dynamic_body>& request();
 	http::response<http::dynamic_body>& response();
+	//the handler finishes asynchronously and calls SendResponse itself
+	void DeferResponse();
+	void SendResponse();
+	//trace of this request, handlers make it current again in their async callbacks
+	const TraceContext& Trace() const { return span_.context; }
 private:
+	void Read();
 	void HandleRequest();
+	//false when the throttle rejected the request, the response is already filled in
+	bool Admit();
 	void CheckTime();
-	void SendResponse();
+	//runs fn on the tls stream or on the plain socket
+	template<class Fn>
+	void WithStream(Fn&& fn)
+	{
+		if (tls_) fn(*tls_);
+		else fn(socket_);
+	}
 	tcp::socket socket_;
+	std::unique_ptr<asio::ssl::stream<tcp::socket&>> tls_;
 	beast::flat_buffer buffer_{ 4096 };
 	http::request<http::dynamic_body> request_;
 	http::response<http::dynamic_body> response_;
+	bool deferred_ = false;
+	TraceSpan span_;
 	asio::steady_timer timer_{ socket_.get_executor(), std::chrono::seconds(30) };
 };
 
@@ -2,6 +2,7 @@
 #include "Server.h"
 #include "ioContextPool.h"
 #include "message.pb.h"
+#include "UserFilter.h"
 
 int main()
 {
@@ -13,6 +14,8 @@ int main()
 			ioc.stop();
 			exit(0);
 			});
+		//fill the username filter before the first request arrives
+		UserFilter::Instance();
 		std::make_shared<Server>(ioc, port)->start();
 		ioc.run();
 	}
@@ -6,6 +6,12 @@
 #include "StatusGrpcClient.h"
 #include "RedisManager.h"
 #include "MysqlDao.h"
+#include "AuditWriter.h"
+#include "PasswordHasher.h"
+#include "UserFilter.h"
+#include "TlsContext.h"
+#include "Tracer.h"
+#include "ConfigMgr.h"
 
 #include <mutex>
 #include <json/json.h>
@@ -21,6 +27,42 @@ LogicSystem::LogicSystem()
 		{
 			beast::ostream(connection->response().body()) << "receive get\r\n";
 		});
+	//internal numbers, off unless [Stats] Enabled, the gate port is public
+	if (ConfigMgr::Instance().Get<bool>("Stats.Enabled", false))
+	{
+		//per channel load of the grpc backends
+		RegiserGetHandle("/rpc_stats", [](shared_ptr<Connection> connection)
+			{
+				auto dump = [](const vector<ChannelStats>& stats) {
+					Json::Value channels(Json::arrayValue);
+					for (auto& stat : stats)
+					{
+						Json::Value channel;
+						channel["in_flight"] = stat.inFlight;
+						channel["completed"] = Json::UInt64(stat.completed);
+						channel["failed"] = Json::UInt64(stat.failed);
+						channels.append(channel);
+					}
+					return channels;
+				};
+				connection->response().set(http::field::content_type, "text/json");
+				Json::Value response;
+				response["status"] = dump(StatusGrpcClient::Instance().Stats());
+				response["varify"] = dump(VarifyClient::GetInstance()->Stats());
+				beast::ostream(connection->response().body()) << response.toStyledString();
+			});
+		//resumed handshakes should be most of them
+		RegiserGetHandle("/tls_stats", [](shared_ptr<Connection> connection)
+			{
+				auto& tls = TlsContext::Instance();
+				connection->response().set(http::field::content_type, "text/json");
+				Json::Value response;
+				response["enabled"] = tls.Enabled();
+				response["handshakes"] = Json::UInt64(tls.Handshakes());
+				response["resumed"] = Json::UInt64(tls.Resumed());
+				beast::ostream(connection->response().body()) << response.toStyledString();
+			});
+	}
 	// ȡ֤
 	RegiserPostHandle("/varify", [](shared_ptr<Connection> connection)
 		{
@@ -41,9 +83,17 @@ LogicSystem::LogicSystem()
 			else
 			{
 				string email = request["email"].asString();
-				message::VarifyRes res = VarifyClient::GetInstance()->GetVarifyCode(email);
-				response["error"] = Json::Value(res.error());
-				response["email"] = Json::Value(res.email());
+				//answered once VerifyServer replied, the io thread moves on meanwhile
+				connection->DeferResponse();
+				VarifyClient::GetInstance()->AsyncGetVarifyCode(email, [connection](message::VarifyRes res)
+				{
+					Json::Value response;
+					response["error"] = Json::Value(res.error());
+					response["email"] = Json::Value(res.email());
+					beast::ostream(connection->response().body()) << response.toStyledString();
+					connection->SendResponse();
+				});
+				return;
 			}
 			string jsonstr = response.toStyledString();
 			beast::ostream(connection->response().body()) << jsonstr;
@@ -71,41 +121,90 @@ LogicSystem::LogicSystem()
 			string email = request["email"].asString();
 			string confirm = request["confirm"].asString();
 
-			//֤
-			auto VarifyCode = RedisManager::Instance().GetRedis().get(request["email"].asString());
-			if (!VarifyCode)
-			{
-				//Debug
-				cout << "Get Varifycode Expired\n";
-				response["error"] = ErrorCodes::VarifyExpired;
-				beast::ostream(connection->response().body()) << response.toStyledString();
-				return;
-			}
-			//֤벻ƥ
-			if (*VarifyCode != request["varifycode"].asString())
+			//the code is checked without blocking this io thread and only used up once the user is in
+			connection->DeferResponse();
+			RedisManager::Instance().AsyncVerifyCode(email, request["varifycode"].asString(), [connection, request, name, password, email, confirm](int error)
 			{
-				//Debug
-				cout << "Varifycode Error\n";
-				response["error"] = ErrorCodes::VarifyCodeErr;
-				beast::ostream(connection->response().body()) << response.toStyledString();
-				return;
-			}
-			//ûǷ
-			int uid = MysqlDao::Instance().UserRegister(name, password, email);
-			if (uid == 0 || uid == -1)
+				TraceScope scope(connection->Trace());
+				Json::Value response;
+				//֤ڻƥ
+				if (error != ErrorCodes::SUCCESS)
+				{
+					//Debug
+					cout << "Varifycode Error: " << error << endl;
+					response["error"] = error;
+					beast::ostream(connection->response().body()) << response.toStyledString();
+					connection->SendResponse();
+					return;
+				}
+				//only the hash is stored
+				TraceSpan hashing = Tracer::Instance().Start(connection->Trace(), "PasswordHasher Hash");
+				bool queued = PasswordHasher::Instance().AsyncHash(password, [connection, request, name, password, email, confirm, hashing](string hash)
+				{
+					//queue wait and hashing
+					Tracer::Instance().End(hashing);
+					TraceScope scope(connection->Trace());
+					Json::Value response;
+					if (hash.empty())
+					{
+						response["error"] = ErrorCodes::PasswordUpFailed;
+						beast::ostream(connection->response().body()) << response.toStyledString();
+						connection->SendResponse();
+						return;
+					}
+					//ûǷ
+					//names the filter has never seen skip the existence checks
+					auto& filter = UserFilter::Instance();
+					bool fresh = !filter.MayContainName(name) && !filter.MayContainEmail(email);
+					int uid = fresh ? MysqlDao::Instance().UserInsert(name, hash, email) : MysqlDao::Instance().UserRegister(name, hash, email);
+					if (uid == 0 || uid == -1)
+					{
+						//Debug
+						cout << "user or email exist\n";
+						response["error"] = ErrorCodes::UserExist;
+						beast::ostream(connection->response().body()) << response.toStyledString();
+						connection->SendResponse();
+						return;
+					}
+					filter.Add(name, email);
+					RedisManager::Instance().ConsumeCode(email);
+					response["error"] = ErrorCodes::SUCCESS;
+					response["email"] = email;
+					response["user"] = name;
+					response["password"] = password;
+					response["confirm"] = confirm;
+					response["varifycode"] = request["varifycode"].asString();
+					beast::ostream(connection->response().body()) << response.toStyledString();
+					connection->SendResponse();
+				});
+				if (!queued)
+				{
+					Tracer::Instance().End(hashing, "queue full");
+					response["error"] = ErrorCodes::ServerBusy;
+					beast::ostream(connection->response().body()) << response.toStyledString();
+					connection->SendResponse();
+				}
+			});
+		});
+	//answered from the filter alone, a false positive reports a free name as taken.
+	//emails are not answered here, that would tell anyone which addresses have an account
+	RegiserPostHandle("/check_user", [](shared_ptr<Connection> connection)
+		{
+			string data = beast::buffers_to_string(connection->request().body().data());
+			connection->response().set(http::field::content_type, "text/json");
+			Json::Value response;
+			Json::Value request;
+			Json::Reader reader;
+			if (!reader.parse(data, request))
 			{
-				//Debug
-				cout << "user or email exist\n";
-				response["error"] = ErrorCodes::UserExist;
+				response["error"] = ErrorCodes::JsonErr;
 				beast::ostream(connection->response().body()) << response.toStyledString();
 				return;
 			}
+
+			auto& filter = UserFilter::Instance();
 			response["error"] = ErrorCodes::SUCCESS;
-			response["email"] = email;
-			response["user"] = name;
-			response["password"] = password;
-			response["confirm"] = confirm;
-			response["varifycode"] = request["varifycode"].asString();
+			if (request.isMember("user")) response["user_taken"] = filter.MayContainName(request["user"].asString());
 			beast::ostream(connection->response().body()) << response.toStyledString();
 		});
 	// ¼
@@ -128,34 +227,77 @@ LogicSystem::LogicSystem()
 
 			string name = request["user"].asString();
 			string password = request["password"].asString();
+			boost::system::error_code ec;
+			string ip = connection->socket().remote_endpoint(ec).address().to_string();
 			UserInfo userInfo;
 			//ѯݿ
-			if (!MysqlDao::Instance().UserLogin(name, password, userInfo))
+			bool known = MysqlDao::Instance().GetUser(name, userInfo);
+			if (!known)
 			{
-				response["error"] = ErrorCodes::PasswordErr;
-				beast::ostream(connection->response().body()) << response.toStyledString();
-				return;
+				//an unknown name pays for a hash like a wrong password, the time taken tells nothing
+				userInfo.uid = 0;
+				userInfo.password = PasswordHasher::Instance().DummyHash();
 			}
-			//ȡChatServer
-			auto res = StatusGrpcClient::Instance().GetChatServer(userInfo.uid);
-			if (res.error())
+			//the hash is checked on the hasher threads, a full queue turns the login away
+			connection->DeferResponse();
+			TraceSpan verify = Tracer::Instance().Start(connection->Trace(), "PasswordHasher Verify");
+			bool queued = PasswordHasher::Instance().AsyncVerify(password, userInfo.password, [connection, known, uid = userInfo.uid, ip, name, verify](bool ok)
 			{
-				// Debug
-				cout << "get chat server failed: " << res.error() << endl;
-				response["error"] = ErrorCodes::RPCGetFailed;
-				beast::ostream(connection->response().body()) << response.toStyledString();
-				return;
-			}
+				//queue wait and hashing
+				Tracer::Instance().End(verify);
+				TraceScope scope(connection->Trace());
+				if (!ok || !known)
+				{
+					Json::Value response;
+					response["error"] = ErrorCodes::PasswordErr;
+					AuditWriter::Instance().Record(uid, ip, ErrorCodes::PasswordErr);
+					beast::ostream(connection->response().body()) << response.toStyledString();
+					connection->SendResponse();
+					return;
+				}
+				//ȡChatServer
+				StatusGrpcClient::Instance().AsyncGetChatServer(uid, [connection, uid, ip, name](GetStatusServiceRes res)
+				{
+					Json::Value response;
+					if (res.error())
+					{
+						// Debug
+						cout << "get chat server failed: " << res.error() << endl;
+						response["error"] = ErrorCodes::RPCGetFailed;
+						AuditWriter::Instance().Record(uid, ip, ErrorCodes::RPCGetFailed);
+						beast::ostream(connection->response().body()) << response.toStyledString();
+						connection->SendResponse();
+						return;
+					}
 
-			// Debug
-			cout << "get get chat server success uid: " << userInfo.uid << endl;
+					// Debug
+					cout << "get get chat server success uid: " << uid << endl;
 
-			response["error"] = ErrorCodes::SUCCESS;
-			response["uid"] = userInfo.uid;
-			response["user"] = name;
-			response["host"] = res.host();
-			response["token"] = res.token();
-			beast::ostream(connection->response().body()) << response.toStyledString();
+					AuditWriter::Instance().Record(uid, ip, ErrorCodes::SUCCESS);
+					response["error"] = ErrorCodes::SUCCESS;
+					response["uid"] = uid;
+					response["user"] = name;
+					response["host"] = res.host();
+					response["token"] = res.token();
+					beast::ostream(connection->response().body()) << response.toStyledString();
+					connection->SendResponse();
+				});
+			}, [uid = userInfo.uid, name](const string& newHash)
+			{
+				//plaintext rows and old cost settings are upgraded here, on the hasher thread
+				if (!MysqlDao::Instance().UpdatePassword(uid, name, newHash))
+				{
+					//TODO use log to print
+					cerr << "rehash password failed uid: " << uid << endl;
+				}
+			});
+			if (!queued)
+			{
+				Tracer::Instance().End(verify, "queue full");
+				response["error"] = ErrorCodes::ServerBusy;
+				beast::ostream(connection->response().body()) << response.toStyledString();
+				connection->SendResponse();
+			}
 		});
 }
 
@@ -1,15 +1,34 @@
 #include "MysqlDao.h"
 #include "MysqlPool.h"
+#include "UserCache.h"
+#include "ConfigMgr.h"
+#include "Tracer.h"
 
 using namespace std;
 using namespace sql;
 using PreparedStatementPtr = unique_ptr<PreparedStatement>;
 using ResultSetPtr = unique_ptr<ResultSet>;
 
+std::string FoldKey(const std::string& key)
+{
+	string folded(key);
+	//bytes of multibyte utf-8 characters are all >= 0x80 and stay untouched
+	for (char& c : folded)
+	{
+		if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+	}
+	return folded;
+}
+
 MysqlDao::MysqlDao()
 {
 	//TODO use configuration files to read settings
 	pool_.reset(new MysqlPool("tcp://127.0.0.1/chat", "root", "123456", 3));
+	auto& config = ConfigMgr::Instance();
+	cache_.reset(new UserCache(config.Get<size_t>("UserCache.Capacity", 100000),
+		chrono::milliseconds(config.Get<int>("UserCache.TtlMs", 30000)),
+		chrono::milliseconds(config.Get<int>("UserCache.NegativeTtlMs", 5000)),
+		max(config.Get<size_t>("UserCache.Shards", 16), (size_t)1)));
 }
 
 MysqlDao::~MysqlDao()
@@ -19,11 +38,22 @@ MysqlDao::~MysqlDao()
 
 int MysqlDao::UserRegister(const std::string& name, const std::string& password, const std::string& email)
 {
-	auto con = pool_->GetConnection();
+	return CallRegister("UserRegister", name, password, email);
+}
+
+int MysqlDao::UserInsert(const std::string& name, const std::string& password, const std::string& email)
+{
+	return CallRegister("UserInsert", name, password, email);
+}
+
+int MysqlDao::CallRegister(const std::string& procedure, const std::string& name, const std::string& password, const std::string& email)
+{
+	auto con = GetConnection();
 	if (!con) return -1;
+	ScopedSpan span("mysql " + procedure);
 	try
 	{
-		PreparedStatementPtr stm(con->prepareStatement("CALL UserRegister(?,?,?,@result)"));
+		PreparedStatementPtr stm(con->prepareStatement("CALL " + procedure + "(?,?,?,@result)"));
 		stm->setString(1, name);
 		stm->setString(2, password);
 		stm->setString(3, email);
@@ -36,6 +66,8 @@ int MysqlDao::UserRegister(const std::string& name, const std::string& password,
 			//Debug
 			cout << "result: " << result << endl;
 			pool_->ReturnConnection(con);
+			//drops the negative entry of the new name
+			if (result > 0) cache_->Invalidate(name);
 			return result;
 		}
 		pool_->ReturnConnection(con);
@@ -44,33 +76,159 @@ int MysqlDao::UserRegister(const std::string& name, const std::string& password,
 	catch (SQLException& e)
 	{
 		pool_->ReturnConnection(con);
+		span.Fail(e.what());
 		//TODO use log to print
 		cerr << "SQLException: " << e.what() << " code: " << e.getErrorCode() << endl;
 	}
 	return -1;
 }
 
-bool MysqlDao::UserLogin(const std::string& name, const std::string& password, UserInfo& userInfo)
+bool MysqlDao::GetUser(const std::string& name, UserInfo& userInfo)
 {
-	auto con = pool_->GetConnection();
+	bool found;
+	uint64_t version;
+	if (cache_->Get(name, userInfo, found, version)) return found;
+	auto con = GetConnection();
 	if (!con) return false;
+	ScopedSpan span("mysql GetUser");
 	try
 	{
-		PreparedStatementPtr stm(con->prepareStatement("SELECT * FROM user WHERE user = ?"));
+		//served by idx_user_login, columns are read by position
+		PreparedStatementPtr stm(con->prepareStatement("SELECT uid, password, email FROM user WHERE user = ?"));
 		stm->setString(1, name);
 
 		ResultSetPtr res(stm->executeQuery());
-		string pwd;
-		if (res->next())
+		if (!res->next())
 		{
-			pwd = res->getString("password");
+			pool_->ReturnConnection(con);
+			cache_->Put(name, nullptr, version);
+			return false;
 		}
-		if (pwd != password) return false;
 
-		userInfo.uid = res->getInt("uid");
-		userInfo.name = res->getString("user");
-		userInfo.password = pwd;
-		userInfo.email = res->getString("email");
+		userInfo.uid = res->getInt(1);
+		userInfo.name = name;
+		userInfo.password = res->getString(2);
+		userInfo.email = res->getString(3);
+		pool_->ReturnConnection(con);
+		cache_->Put(name, &userInfo, version);
+		return true;
+	}
+	catch (SQLException& e)
+	{
+		pool_->ReturnConnection(con);
+		span.Fail(e.what());
+		//TODO use log to print
+		cerr << "SQLException: " << e.what() << " code: " << e.getErrorCode() << endl;
+		return false;
+	}
+}
+
+int MysqlDao::LoadUsers(int afterId, int limit, const std::function<void(const std::string&, const std::string&)>& row)
+{
+	auto con = GetConnection();
+	if (!con) return -1;
+	try
+	{
+		PreparedStatementPtr stm(con->prepareStatement("SELECT id, user, email FROM user WHERE id > ? ORDER BY id LIMIT ?"));
+		stm->setInt(1, afterId);
+		stm->setInt(2, limit);
+
+		ResultSetPtr res(stm->executeQuery());
+		int last = afterId;
+		while (res->next())
+		{
+			last = res->getInt(1);
+			row(res->getString(2), res->getString(3));
+		}
+		pool_->ReturnConnection(con);
+		return last;
+	}
+	catch (SQLException& e)
+	{
+		pool_->ReturnConnection(con);
+		//TODO use log to print
+		cerr << "SQLException: " << e.what() << " code: " << e.getErrorCode() << endl;
+		return -1;
+	}
+}
+
+int MysqlDao::MaxUserId()
+{
+	auto con = GetConnection();
+	if (!con) return -1;
+	try
+	{
+		ResultSetPtr res(con->createStatement()->executeQuery("SELECT COALESCE(MAX(id), 0) FROM user"));
+		int id = res->next() ? res->getInt(1) : 0;
+		pool_->ReturnConnection(con);
+		return id;
+	}
+	catch (SQLException& e)
+	{
+		pool_->ReturnConnection(con);
+		//TODO use log to print
+		cerr << "SQLException: " << e.what() << " code: " << e.getErrorCode() << endl;
+		return -1;
+	}
+}
+
+bool MysqlDao::UpdatePassword(int uid, const std::string& name, const std::string& password)
+{
+	auto con = GetConnection();
+	if (!con) return false;
+	ScopedSpan span("mysql UpdatePassword");
+	try
+	{
+		PreparedStatementPtr stm(con->prepareStatement("UPDATE user SET password = ? WHERE uid = ?"));
+		stm->setString(1, password);
+		stm->setInt(2, uid);
+		int rows = stm->executeUpdate();
+		pool_->ReturnConnection(con);
+		//after the write, a lookup that read the old hash meanwhile is not stored
+		cache_->Invalidate(name);
+		return rows == 1;
+	}
+	catch (SQLException& e)
+	{
+		pool_->ReturnConnection(con);
+		span.Fail(e.what());
+		//TODO use log to print
+		cerr << "SQLException: " << e.what() << " code: " << e.getErrorCode() << endl;
+		return false;
+	}
+}
+
+std::unique_ptr<sql::Connection> MysqlDao::GetConnection()
+{
+	//time spent waiting for a free connection, apart from the query itself
+	ScopedSpan span("mysql pool wait");
+	return pool_->GetConnection();
+}
+
+bool MysqlDao::InsertLoginAudits(const std::vector<LoginAudit>& audits)
+{
+	if (audits.empty()) return true;
+	auto con = GetConnection();
+	if (!con) return false;
+	try
+	{
+		//one multi-row INSERT per batch
+		string sql = "INSERT INTO login_audit (uid, ip, time, result) VALUES ";
+		for (size_t i = 0; i < audits.size(); ++i)
+		{
+			sql += i ? ",(?,?,FROM_UNIXTIME(? / 1000),?)" : "(?,?,FROM_UNIXTIME(? / 1000),?)";
+		}
+		PreparedStatementPtr stm(con->prepareStatement(sql));
+		int index = 1;
+		for (auto& audit : audits)
+		{
+			stm->setInt(index++, audit.uid);
+			stm->setString(index++, audit.ip);
+			stm->setInt64(index++, audit.time);
+			stm->setInt(index++, audit.result);
+		}
+		stm->executeUpdate();
+		pool_->ReturnConnection(con);
 		return true;
 	}
 	catch (SQLException& e)
@@ -1,9 +1,13 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <vector>
+#include <functional>
 #include "Singleton.ipp"
 
 class MysqlPool;
+class UserCache;
+namespace sql { class Connection; }
 
 struct UserInfo
 {
@@ -13,15 +17,43 @@ struct UserInfo
 	std::string email;
 };
 
+struct LoginAudit
+{
+	int uid;
+	std::string ip;
+	long long time; //milliseconds since epoch
+	int result;
+};
+
+//user and email compare case-insensitively in mysql (the utf8mb4 default _ci collation),
+//keys of in-memory lookups are folded the same way. Only ascii letters are lowered,
+//other differences the collation ignores are still caught by the unique keys
+std::string FoldKey(const std::string& key);
+
 class MysqlDao : public Singleton<MysqlDao>
 {
 	friend class Singleton<MysqlDao>;
 public:
 	~MysqlDao();
 	int UserRegister(const std::string &name, const std::string &password, const std::string &email);
-	bool UserLogin(const std::string& name, const std::string& password, UserInfo& userInfo);
+	//same result as UserRegister without looking the name and email up first,
+	//for names known to be new. A taken name is still caught by the unique keys
+	int UserInsert(const std::string& name, const std::string& password, const std::string& email);
+	//calls row(name, email) for up to limit users with id > afterId in id order,
+	//returns the id of the last row read, afterId when there was none, -1 on error
+	int LoadUsers(int afterId, int limit, const std::function<void(const std::string&, const std::string&)>& row);
+	int MaxUserId();
+	//loads uid, stored password hash and email, the caller checks the password.
+	//answered from the user cache when possible, unknown names included
+	bool GetUser(const std::string& name, UserInfo& userInfo);
+	bool UpdatePassword(int uid, const std::string& name, const std::string& password);
+	bool InsertLoginAudits(const std::vector<LoginAudit>& audits);
 private:
 	MysqlDao();
+	//pool_->GetConnection with the wait traced
+	std::unique_ptr<sql::Connection> GetConnection();
+	int CallRegister(const std::string& procedure, const std::string& name, const std::string& password, const std::string& email);
 	std::unique_ptr<MysqlPool> pool_;
+	std::unique_ptr<UserCache> cache_;
 };
 
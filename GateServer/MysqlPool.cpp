@@ -1,16 +1,22 @@
 #include "MysqlPool.h"
+#include <algorithm>
 
 using namespace std;
 using namespace sql;
 
+//each thread picks a stash slot once, io threads keep hitting the same one
+static atomic_size_t ThreadCount(0);
+
 MysqlPool::MysqlPool(const std::string& url, const std::string& usr, const std::string& password, int size)
-	:size_(size),
-	running_(true)
+	:size_(max(size, 1)), //a pool of 0 could never hand out a connection
+	slots_(size_),
+	running_(true),
+	waiting_(0)
 {
 	Driver* drive = get_driver_instance();
 	try
 	{
-		for (int i = 0; i < size; ++i)
+		for (int i = 0; i < size_; ++i)
 		{
 			connection con(drive->connect(url, usr, password));
 			if (!con->isValid())
@@ -33,24 +39,54 @@ MysqlPool::~MysqlPool()
 {
 	lock_guard<mutex> lock(mutex_);
 	pool_.clear();
+	for (auto& slot : slots_)
+	{
+		delete slot.con.exchange(nullptr);
+	}
 }
 
 MysqlPool::connection MysqlPool::GetConnection()
 {
+	if (!running_) return nullptr;
+	//fast path: the connection this thread returned last time
+	connection con(ThreadSlot().exchange(nullptr));
+	if (con) return con;
+
 	unique_lock<mutex> lock(mutex_);
-	cond_.wait(lock, [this] {
-		return !pool_.empty() || !running_;
-		});
+	++waiting_;
+	while (running_ && pool_.empty())
+	{
+		//connections idling in other threads' stashes are handed over here
+		con.reset(StealConnection());
+		if (con) break;
+		cond_.wait(lock);
+	}
+	--waiting_;
 	if (!running_) return nullptr;
-	connection con(move(pool_.front()));
+	if (con) return con;
+	con = move(pool_.front());
 	pool_.pop_front();
 	return con;
 }
 
 void MysqlPool::ReturnConnection(connection& con)
 {
-	unique_lock<mutex> lock(mutex_);
 	if (!running_) return;
+	//fast path: keep it in this thread's stash when nobody is waiting
+	if (waiting_ == 0)
+	{
+		sql::Connection* expected = nullptr;
+		auto& slot = ThreadSlot();
+		if (slot.compare_exchange_strong(expected, con.get()))
+		{
+			con.release();
+			if (waiting_ == 0) return;
+			//a borrower started waiting meanwhile, move it to the shared deque
+			con.reset(slot.exchange(nullptr));
+			if (!con) return;
+		}
+	}
+	lock_guard<mutex> lock(mutex_);
 	pool_.push_back(move(con));
 	cond_.notify_one();
 }
@@ -58,5 +94,21 @@ void MysqlPool::ReturnConnection(connection& con)
 void MysqlPool::close()
 {
 	running_ = false;
+	lock_guard<mutex> lock(mutex_);
 	cond_.notify_all();
 }
+
+atomic<sql::Connection*>& MysqlPool::ThreadSlot()
+{
+	static thread_local size_t index = ThreadCount++;
+	return slots_[index % slots_.size()].con;
+}
+
+sql::Connection* MysqlPool::StealConnection()
+{
+	for (auto& slot : slots_)
+	{
+		if (sql::Connection* con = slot.con.exchange(nullptr)) return con;
+	}
+	return nullptr;
+}
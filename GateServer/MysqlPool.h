@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <deque>
+#include <vector>
 #include <memory>
 #include <mutex>
 #include <condition_variable>
@@ -19,10 +20,21 @@ public:
 	void ReturnConnection(connection &con);
 	void close();
 private:
+	//per thread stash, only touched with atomic exchange so the fast path takes no lock
+	struct alignas(64) LocalSlot
+	{
+		std::atomic<sql::Connection*> con{ nullptr };
+	};
+
+	std::atomic<sql::Connection*>& ThreadSlot();
+	sql::Connection* StealConnection();
+
 	int size_;
 	std::deque<std::unique_ptr<sql::Connection>> pool_;
+	std::vector<LocalSlot> slots_;
 	std::mutex mutex_;
 	std::condition_variable cond_;
 	std::atomic_bool running_;
+	std::atomic_int waiting_;
 };
 
@@ -0,0 +1,179 @@
+#include "PasswordHasher.h"
+#include "ConfigMgr.h"
+#include "RpcPoller.h"
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/crypto.h>
+#include <algorithm>
+#include <sstream>
+#include <iostream>
+
+using namespace std;
+
+static const char Prefix[] = "$scrypt$";
+static const size_t SaltSize = 16;
+static const size_t HashSize = 32;
+//bounds for the config and for stored hashes alike, at most 128 * 16 * 2^20 bytes = 2 GiB per hash
+static const int MinLogN = 10;
+static const int MaxLogN = 20;
+static const int MaxR = 16;
+static const int MaxP = 16;
+
+static string Base64(const uint8_t* data, size_t len)
+{
+	string out(4 * ((len + 2) / 3) + 1, '\0');
+	int n = EVP_EncodeBlock((unsigned char*)&out[0], data, (int)len);
+	out.resize(n);
+	while (!out.empty() && out.back() == '=') out.pop_back();
+	return out;
+}
+
+static bool Unbase64(string in, string& out)
+{
+	size_t pad = (4 - in.size() % 4) % 4;
+	if (pad == 3) return false;
+	in.append(pad, '=');
+	out.assign(3 * in.size() / 4 + 1, '\0');
+	int n = EVP_DecodeBlock((unsigned char*)&out[0], (const unsigned char*)in.data(), (int)in.size());
+	if (n < 0) return false;
+	out.resize(n - pad);
+	return true;
+}
+
+PasswordHasher::PasswordHasher()
+	:running_(true)
+{
+	auto& config = ConfigMgr::Instance();
+	params_.logN = min(max(config.Get<int>("Password.ScryptLogN", 15), MinLogN), MaxLogN);
+	params_.r = min(max(config.Get<int>("Password.ScryptR", 8), 1), MaxR);
+	params_.p = min(max(config.Get<int>("Password.ScryptP", 1), 1), MaxP);
+	capacity_ = max(config.Get<size_t>("Password.QueueSize", 256), (size_t)1);
+	uint8_t secret[SaltSize];
+	RAND_bytes(secret, sizeof(secret));
+	dummy_ = Hash(Base64(secret, sizeof(secret)));
+	int threads = config.Get<int>("Password.Threads", 0);
+	if (threads <= 0) threads = max(1, (int)thread::hardware_concurrency() / 2);
+	for (int i = 0; i < threads; ++i)
+	{
+		threads_.emplace_back([this] { run(); });
+	}
+}
+
+PasswordHasher::~PasswordHasher()
+{
+	running_ = false;
+	cond_.notify_all();
+	for (auto& thread : threads_)
+	{
+		if (thread.joinable()) thread.join();
+	}
+}
+
+std::string PasswordHasher::Hash(const std::string& password)
+{
+	uint8_t salt[SaltSize];
+	uint8_t hash[HashSize];
+	if (RAND_bytes(salt, sizeof(salt)) != 1) return "";
+	if (!Derive(password, string((char*)salt, sizeof(salt)), params_, hash, sizeof(hash))) return "";
+	stringstream out;
+	out << Prefix << "ln=" << params_.logN << ",r=" << params_.r << ",p=" << params_.p
+		<< "$" << Base64(salt, sizeof(salt)) << "$" << Base64(hash, sizeof(hash));
+	return out.str();
+}
+
+bool PasswordHasher::Verify(const std::string& password, const std::string& stored, bool& rehash)
+{
+	rehash = false;
+	if (stored.compare(0, sizeof(Prefix) - 1, Prefix) != 0)
+	{
+		//rows written before hashing was introduced
+		if (stored.empty() || stored.size() != password.size()) return false;
+		if (CRYPTO_memcmp(stored.data(), password.data(), stored.size()) != 0) return false;
+		rehash = true;
+		return true;
+	}
+
+	Params params;
+	char salt[64], hash[64];
+	if (sscanf(stored.c_str() + sizeof(Prefix) - 1, "ln=%d,r=%d,p=%d$%63[^$]$%63s", &params.logN, &params.r, &params.p, salt, hash) != 5) return false;
+	//nothing this gate could have written, do not let a corrupted row ask for more memory
+	if (params.logN < MinLogN || params.logN > MaxLogN || params.r < 1 || params.r > MaxR || params.p < 1 || params.p > MaxP) return false;
+	string rawSalt, rawHash;
+	if (!Unbase64(salt, rawSalt) || !Unbase64(hash, rawHash) || rawHash.empty() || rawHash.size() > 64) return false;
+	uint8_t derived[64];
+	if (!Derive(password, rawSalt, params, derived, rawHash.size())) return false;
+	if (CRYPTO_memcmp(derived, rawHash.data(), rawHash.size()) != 0) return false;
+	rehash = params.logN != params_.logN || params.r != params_.r || params.p != params_.p;
+	return true;
+}
+
+bool PasswordHasher::AsyncHash(std::string password, std::function<void(std::string)> callback)
+{
+	auto& ioc = RpcPoller::CallerContext();
+	return Submit([this, &ioc, password = move(password), callback = move(callback)]() {
+		string hash = Hash(password);
+		boost::asio::post(ioc, [callback, hash = move(hash)]() { callback(hash); });
+	});
+}
+
+bool PasswordHasher::AsyncVerify(std::string password, std::string stored, std::function<void(bool ok)> callback, std::function<void(const std::string&)> rehash)
+{
+	auto& ioc = RpcPoller::CallerContext();
+	return Submit([this, &ioc, password = move(password), stored = move(stored), callback = move(callback), rehash = move(rehash)]() {
+		bool outdated;
+		bool ok = Verify(password, stored, outdated);
+		boost::asio::post(ioc, [callback, ok]() { callback(ok); });
+		//the login is answered already, the upgrade only costs this thread
+		if (!ok || !outdated || !rehash) return;
+		string newHash = Hash(password);
+		if (!newHash.empty()) rehash(newHash);
+	});
+}
+
+const std::string& PasswordHasher::DummyHash() const
+{
+	return dummy_;
+}
+
+bool PasswordHasher::Submit(std::function<void()> task)
+{
+	{
+		lock_guard<mutex> lock(mutex_);
+		//a full queue means the cpus are saturated, waiting longer only adds latency
+		if (tasks_.size() >= capacity_) return false;
+		tasks_.push_back(move(task));
+	}
+	cond_.notify_one();
+	return true;
+}
+
+void PasswordHasher::run()
+{
+	while (true)
+	{
+		function<void()> task;
+		{
+			unique_lock<mutex> lock(mutex_);
+			cond_.wait(lock, [this] { return !tasks_.empty() || !running_; });
+			if (tasks_.empty()) return;
+			task = move(tasks_.front());
+			tasks_.pop_front();
+		}
+		task();
+	}
+}
+
+bool PasswordHasher::Derive(const std::string& password, const std::string& salt, const Params& params, uint8_t* out, size_t len)
+{
+	uint64_t n = 1ULL << params.logN;
+	//scrypt needs 128 * r * (N + p) bytes, openssl refuses anything above maxmem
+	uint64_t maxmem = 128ULL * params.r * (n + params.p) + (1 << 20);
+	if (EVP_PBE_scrypt(password.data(), password.size(), (const unsigned char*)salt.data(), salt.size(),
+		n, params.r, params.p, maxmem, out, len) != 1)
+	{
+		//TODO use log to print
+		cerr << "scrypt failed, ln=" << params.logN << " r=" << params.r << " p=" << params.p << endl;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <string>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <cstdint>
+#include "Singleton.ipp"
+
+//scrypt password hashes computed on a fixed set of cpu threads, apart from the io threads.
+//stored as $scrypt$ln=<log2 N>,r=<r>,p=<p>$<salt>$<hash>, salt and hash in unpadded base64.
+//the Async calls fail when the queue is full and post their callback to the caller's io context
+class PasswordHasher : public Singleton<PasswordHasher>
+{
+	friend class Singleton<PasswordHasher>;
+public:
+	~PasswordHasher();
+	std::string Hash(const std::string& password);
+	//rehash is set when the stored value is plaintext or uses other cost parameters
+	bool Verify(const std::string& password, const std::string& stored, bool& rehash);
+
+	bool AsyncHash(std::string password, std::function<void(std::string)> callback);
+	//when the password matched and the stored value should be replaced, rehash gets the new hash
+	//on the hasher thread after callback was posted, so writing it back blocks no io thread
+	bool AsyncVerify(std::string password, std::string stored, std::function<void(bool ok)> callback, std::function<void(const std::string&)> rehash);
+	//hash of a random password with the current settings, checked for unknown users so they
+	//cost as much as a wrong password and the timing does not tell whether a name exists
+	const std::string& DummyHash() const;
+private:
+	struct Params
+	{
+		int logN;
+		int r;
+		int p;
+	};
+
+	PasswordHasher();
+	bool Submit(std::function<void()> task);
+	void run();
+	static bool Derive(const std::string& password, const std::string& salt, const Params& params, uint8_t* out, size_t len);
+
+	Params params_;
+	std::string dummy_;
+	size_t capacity_;
+	std::deque<std::function<void()>> tasks_;
+	std::mutex mutex_;
+	std::condition_variable cond_;
+	std::atomic_bool running_;
+	std::vector<std::thread> threads_;
+};
@@ -1,30 +1,289 @@
 #include "RedisManager.h"
+#include "ConfigMgr.h"
+#include "AsyncRedis.h"
+#include "ErrorCodes.h"
+#include <iostream>
+#include <sstream>
 
 using namespace sw::redis;
 using namespace std;
 
-static ConnectionOptions option()
+//points per node on the hash ring
+static const int VirtualNodes = 160;
+//wrong codes accepted before the code is dropped
+static const int MaxVerifyAttempts = 5;
+
+//KEYS[1] code key, KEYS[2] attempt counter, ARGV[1] code, ARGV[2] max attempts
+//returns 1 matched, 0 no code, -1 mismatch
+static const string VerifyScript = R"(
+local code = redis.call('GET', KEYS[1])
+if not code then return 0 end
+if code == ARGV[1] then return 1 end
+local fails = redis.call('INCR', KEYS[2])
+local ttl = redis.call('PTTL', KEYS[1])
+if ttl > 0 then redis.call('PEXPIRE', KEYS[2], ttl) else redis.call('EXPIRE', KEYS[2], 600) end
+if fails >= tonumber(ARGV[2]) then redis.call('DEL', KEYS[1], KEYS[2]) end
+return -1
+)";
+
+//FNV-1a with a murmur finalizer, stable across processes so every
+//GateServer maps a key to the same node
+static uint64_t Hash(const string& str)
 {
-	//TODO: ʹļȡ
-	ConnectionOptions options;
-	options.host = "127.0.0.1";
-	options.port = 6379;
-	return options;
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned char c : str)
+	{
+		hash ^= c;
+		hash *= 1099511628211ULL;
+	}
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	return hash;
 }
 
-static ConnectionPoolOptions PoolOption()
+//only the part inside the first {} is hashed when there is one
+static string HashTag(const string& key)
 {
-	//TODO: ʹļȡ
-	ConnectionPoolOptions PoolOptions;
-	PoolOptions.size = 3;
-	return PoolOptions;
+	size_t begin = key.find('{');
+	if (begin == string::npos) return key;
+	size_t end = key.find('}', begin + 1);
+	if (end == string::npos || end == begin + 1) return key;
+	return key.substr(begin + 1, end - begin - 1);
 }
 
 RedisManager::RedisManager()
-	:redis_(option(), PoolOption())
-{}
+	:batchSize_(ConfigMgr::Instance().Get<size_t>("Redis.BatchSize", 64)),
+	batchWindow_(ConfigMgr::Instance().Get<int>("Redis.BatchWindowUs", 500)),
+	running_(true),
+	codeNode_(0)
+{
+	auto& config = ConfigMgr::Instance();
+	string password = config.Get<string>("Redis.Password", "");
+	size_t poolSize = config.Get<size_t>("Redis.PoolSize", 3);
+	//host:port[:pool size] separated by ','
+	stringstream nodes(config.Get<string>("Redis.Nodes", "127.0.0.1:6379"));
+	string node;
+	while (getline(nodes, node, ','))
+	{
+		stringstream fields(node);
+		string host, port, size;
+		getline(fields, host, ':');
+		getline(fields, port, ':');
+		getline(fields, size, ':');
+		host.erase(0, host.find_first_not_of(' '));
+		if (host.empty() || port.empty()) continue;
+		AddNode(host, stoi(port), size.empty() ? poolSize : stoul(size), password);
+	}
+	if (nodes_.empty()) AddNode("127.0.0.1", 6379, poolSize, password);
+	//host:port of one of the nodes, empty takes the first
+	string codeNode = config.Get<string>("Redis.CodeNode", "");
+	if (!codeNode.empty())
+	{
+		size_t i = 0;
+		while (i < nodes_.size() && nodes_[i]->options.host + ":" + to_string(nodes_[i]->options.port) != codeNode) ++i;
+		if (i < nodes_.size()) codeNode_ = i;
+		//TODO use log to print
+		else cerr << "RedisManager: CodeNode " << codeNode << " is not in Nodes, using the first node" << endl;
+	}
+	for (auto& node : nodes_)
+	{
+		try
+		{
+			//the sha only depends on the script, it is the same on every node
+			verifySha_ = node->redis->script_load(VerifyScript);
+		}
+		catch (const Error& e)
+		{
+			//TODO use log to print
+			cerr << "RedisManager load verify script failed: " << e.what() << endl;
+		}
+	}
+}
 
-Redis& RedisManager::GetRedis()
+RedisManager::~RedisManager()
 {
-	return redis_;
-}
\ No newline at end of file
+	running_ = false;
+	for (auto& node : nodes_)
+	{
+		{
+			lock_guard<mutex> lock(node->mutex);
+		}
+		node->cond.notify_all();
+	}
+	for (auto& node : nodes_)
+	{
+		for (auto& t : node->workers)
+		{
+			t.join();
+		}
+	}
+}
+
+size_t RedisManager::NodeCount() const
+{
+	return nodes_.size();
+}
+
+size_t RedisManager::NodeIndex(const std::string& key) const
+{
+	auto it = ring_.lower_bound(Hash(HashTag(key)));
+	if (it == ring_.end()) it = ring_.begin();
+	return it->second;
+}
+
+const ConnectionOptions& RedisManager::NodeOptions(std::size_t index) const
+{
+	return nodes_[index]->options;
+}
+
+size_t RedisManager::CodeNode() const
+{
+	return codeNode_;
+}
+
+void RedisManager::Batch(const std::string& key, BatchCommand command, BatchReply reply, BatchError error)
+{
+	Node& node = *nodes_[NodeIndex(key)];
+	size_t size;
+	{
+		lock_guard<mutex> lock(node.mutex);
+		node.pending.push_back(BatchItem{ move(command), move(reply), move(error) });
+		size = node.pending.size();
+	}
+	//the first item starts a window, a full batch is sent right away
+	if (size == 1) node.cond.notify_one();
+	else if (size >= batchSize_) node.cond.notify_all();
+}
+
+//kept next to the code on the code node
+static string AttemptKey(const string& email)
+{
+	return "{" + email + "}:attempts";
+}
+
+static int VerifyError(long long result)
+{
+	if (result == 1) return ErrorCodes::SUCCESS;
+	if (result == 0) return ErrorCodes::VarifyExpired;
+	return ErrorCodes::VarifyCodeErr;
+}
+
+void RedisManager::AsyncVerifyCode(const std::string& email, const std::string& code, std::function<void(int)> callback)
+{
+	vector<string> argv{ "EVALSHA", verifySha_, "2", email, AttemptKey(email), code, to_string(MaxVerifyAttempts) };
+	AsyncRedis::Instance().NodeCommand(codeNode_, move(argv), [this, email, code, callback](boost::system::error_code ec, RedisReply reply) {
+		if (ec)
+		{
+			callback(ErrorCodes::RedisErr);
+			return;
+		}
+		if (reply.type == RedisReply::Integer)
+		{
+			callback(VerifyError(reply.integer));
+			return;
+		}
+		if (reply.type != RedisReply::Error || reply.str.compare(0, 8, "NOSCRIPT") != 0)
+		{
+			callback(ErrorCodes::RedisErr);
+			return;
+		}
+		vector<string> argv{ "EVAL", VerifyScript, "2", email, AttemptKey(email), code, to_string(MaxVerifyAttempts) };
+		AsyncRedis::Instance().NodeCommand(codeNode_, move(argv),
+			[callback](boost::system::error_code ec, RedisReply reply) {
+				if (ec || reply.type != RedisReply::Integer) callback(ErrorCodes::RedisErr);
+				else callback(VerifyError(reply.integer));
+			});
+		});
+}
+
+void RedisManager::ConsumeCode(const std::string& email)
+{
+	AsyncRedis::Instance().NodeCommand(codeNode_, { "DEL", email, AttemptKey(email) }, [email](boost::system::error_code ec, RedisReply reply) {
+		if (!ec && reply.type != RedisReply::Error) return;
+		//TODO use log to print
+		cerr << "RedisManager consume code of " << email << " failed, it expires on its own" << endl;
+		});
+}
+
+void RedisManager::AddNode(const std::string& host, int port, std::size_t poolSize, const std::string& password)
+{
+	unique_ptr<Node> node(new Node);
+	node->options.host = host;
+	node->options.port = port;
+	node->options.password = password;
+	ConnectionPoolOptions pool;
+	pool.size = poolSize;
+	node->redis.reset(new Redis(node->options, pool));
+	Node* raw = node.get();
+	string name = host + ":" + to_string(port);
+	for (int i = 0; i < VirtualNodes; ++i)
+	{
+		ring_[Hash(name + "#" + to_string(i))] = nodes_.size();
+	}
+	//one sender per pooled connection
+	for (size_t i = 0; i < poolSize; ++i)
+	{
+		raw->workers.emplace_back([this, raw] { BatchWorker(*raw); });
+	}
+	nodes_.push_back(move(node));
+}
+
+void RedisManager::BatchWorker(Node& node)
+{
+	vector<BatchItem> items;
+	while (true)
+	{
+		{
+			unique_lock<mutex> lock(node.mutex);
+			node.cond.wait(lock, [this, &node] { return !node.pending.empty() || !running_; });
+			if (node.pending.empty()) return;
+			//give concurrent callers a short window to join this batch
+			node.cond.wait_for(lock, batchWindow_, [this, &node] { return node.pending.size() >= batchSize_ || !running_; });
+			if (node.pending.size() <= batchSize_)
+			{
+				items.swap(node.pending);
+			}
+			else
+			{
+				auto end = node.pending.begin() + batchSize_;
+				items.assign(make_move_iterator(node.pending.begin()), make_move_iterator(end));
+				node.pending.erase(node.pending.begin(), end);
+			}
+		}
+		SendBatch(node, items);
+		items.clear();
+	}
+}
+
+void RedisManager::SendBatch(Node& node, std::vector<BatchItem>& items)
+{
+	try
+	{
+		//false: borrow a connection from the pool instead of opening a new one
+		auto pipe = node.redis->pipeline(false);
+		for (auto& item : items)
+		{
+			item.command(pipe);
+		}
+		auto replies = pipe.exec();
+		for (size_t i = 0; i < items.size(); ++i)
+		{
+			try
+			{
+				items[i].reply(replies, i);
+			}
+			catch (...)
+			{
+				items[i].error(current_exception());
+			}
+		}
+	}
+	catch (...)
+	{
+		for (auto& item : items)
+		{
+			item.error(current_exception());
+		}
+	}
+}
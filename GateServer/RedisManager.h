@@ -1,13 +1,73 @@
 #pragma once
 #include "Singleton.ipp"
 #include <sw/redis++/redis.h>
+#include <map>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <atomic>
 
+//keys are spread over standalone redis nodes by a consistent hash ring,
+//a {tag} in the key keeps related keys on one node. Verification codes are not:
+//VerifyServer writes them to its one redis, so they are read from that node (Redis.CodeNode)
 class RedisManager : public Singleton<RedisManager>
 {
 	friend class Singleton<RedisManager>;
 public:
+	//queues exactly one command into the shared pipeline
+	using BatchCommand = std::function<void(sw::redis::Pipeline&)>;
+	//reads the reply of that command at the given index
+	using BatchReply = std::function<void(sw::redis::QueuedReplies&, std::size_t)>;
+	using BatchError = std::function<void(std::exception_ptr)>;
+
 	RedisManager();
-	sw::redis::Redis& GetRedis();
+	~RedisManager();
+	std::size_t NodeCount() const;
+	std::size_t NodeIndex(const std::string& key) const;
+	const sw::redis::ConnectionOptions& NodeOptions(std::size_t index) const;
+	//commands from concurrent callers are sent together as one pipeline per node
+	void Batch(const std::string& key, BatchCommand command, BatchReply reply, BatchError error);
+	//the node holding the verification codes
+	std::size_t CodeNode() const;
+	//compares the code of email in one atomic round trip through AsyncRedis, the callback runs
+	//on the calling io thread with SUCCESS, VarifyExpired, VarifyCodeErr or RedisErr.
+	//failed attempts are counted and the code is dropped after too many.
+	//a matching code is kept until ConsumeCode, so a registration that fails can be retried with it.
+	//that makes a registration two round trips instead of one, the second is not waited for
+	void AsyncVerifyCode(const std::string& email, const std::string& code, std::function<void(int)> callback);
+	//drops the code and its attempt counter once the user is registered, does not wait for the reply
+	void ConsumeCode(const std::string& email);
 private:
-	sw::redis::Redis redis_;
-};
\ No newline at end of file
+	struct BatchItem
+	{
+		BatchCommand command;
+		BatchReply reply;
+		BatchError error;
+	};
+
+	struct Node
+	{
+		sw::redis::ConnectionOptions options;
+		std::unique_ptr<sw::redis::Redis> redis;
+		std::vector<BatchItem> pending;
+		std::mutex mutex;
+		std::condition_variable cond;
+		std::vector<std::thread> workers;
+	};
+
+	void AddNode(const std::string& host, int port, std::size_t poolSize, const std::string& password);
+	void BatchWorker(Node& node);
+	void SendBatch(Node& node, std::vector<BatchItem>& items);
+
+	std::vector<std::unique_ptr<Node>> nodes_;
+	std::map<uint64_t, std::size_t> ring_;
+	std::size_t batchSize_;
+	std::chrono::microseconds batchWindow_;
+	std::atomic_bool running_;
+	std::size_t codeNode_;
+	std::string verifySha_;
+};
@@ -0,0 +1,111 @@
+#include "RpcGuard.h"
+#include "ConfigMgr.h"
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+static long long NowMs()
+{
+	return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+RpcPolicy RpcPolicy::Load(const std::string& section)
+{
+	auto& config = ConfigMgr::Instance();
+	RpcPolicy policy;
+	policy.deadline = chrono::milliseconds(max(1, config.Get<int>(section + ".DeadlineMs", 1000)));
+	policy.hedge = config.Get<bool>(section + ".Hedge", false);
+	policy.breakerFailures = max(1, config.Get<int>(section + ".BreakerFailures", 5));
+	policy.breakerCooldown = chrono::milliseconds(max(1, config.Get<int>(section + ".BreakerCooldownMs", 2000)));
+	return policy;
+}
+
+LatencyTracker::LatencyTracker()
+	:count_(0),
+	p95_(0),
+	computedAt_(0)
+{
+	for (auto& sample : samples_)
+	{
+		sample.store(0, memory_order_relaxed);
+	}
+}
+
+void LatencyTracker::Record(std::chrono::microseconds latency)
+{
+	size_t slot = count_.fetch_add(1, memory_order_relaxed) % Samples;
+	samples_[slot].store((uint32_t)min<long long>(latency.count(), UINT32_MAX), memory_order_relaxed);
+}
+
+std::chrono::microseconds LatencyTracker::P95()
+{
+	long long now = NowMs();
+	long long computedAt = computedAt_.load(memory_order_relaxed);
+	//one caller refreshes, the others keep using the last value
+	if (now - computedAt >= 100 && computedAt_.compare_exchange_strong(computedAt, now, memory_order_relaxed))
+	{
+		size_t count = min(count_.load(memory_order_relaxed), Samples);
+		if (count >= MinSamples)
+		{
+			vector<uint32_t> sorted(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				sorted[i] = samples_[i].load(memory_order_relaxed);
+			}
+			auto nth = sorted.begin() + count * 95 / 100;
+			nth_element(sorted.begin(), nth, sorted.end());
+			p95_.store(*nth, memory_order_relaxed);
+		}
+	}
+	return chrono::microseconds(p95_.load(memory_order_relaxed));
+}
+
+CircuitBreaker::CircuitBreaker(int failures, std::chrono::milliseconds cooldown)
+	:threshold_(failures),
+	cooldown_(cooldown.count()),
+	failures_(0),
+	openUntil_(0),
+	probing_(false)
+{
+}
+
+bool CircuitBreaker::Allow()
+{
+	long long until = openUntil_.load(memory_order_acquire);
+	if (until == 0) return true;
+	if (NowMs() < until) return false;
+	//half open, exactly one caller probes the backend
+	bool expected = false;
+	return probing_.compare_exchange_strong(expected, true);
+}
+
+void CircuitBreaker::Record(bool ok)
+{
+	if (ok)
+	{
+		failures_.store(0, memory_order_relaxed);
+		if (openUntil_.load(memory_order_relaxed) != 0)
+		{
+			openUntil_.store(0, memory_order_release);
+			probing_.store(false);
+		}
+		return;
+	}
+	if (probing_.load())
+	{
+		//the probe failed, wait another cooldown
+		openUntil_.store(NowMs() + cooldown_, memory_order_release);
+		probing_.store(false);
+		return;
+	}
+	if (failures_.fetch_add(1, memory_order_relaxed) + 1 >= threshold_ && openUntil_.load(memory_order_relaxed) == 0)
+	{
+		openUntil_.store(NowMs() + cooldown_, memory_order_release);
+	}
+}
+
+bool CircuitBreaker::IsOpen() const
+{
+	return openUntil_.load(memory_order_relaxed) != 0;
+}
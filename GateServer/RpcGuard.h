@@ -0,0 +1,53 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+
+//limits of the calls to one backend, read from its config section
+struct RpcPolicy
+{
+	std::chrono::milliseconds deadline{ 1000 };
+	//send a second attempt on another channel once a call runs past the p95 latency
+	bool hedge = false;
+	int breakerFailures = 5;
+	std::chrono::milliseconds breakerCooldown{ 2000 };
+
+	//Section.DeadlineMs, Section.Hedge, Section.BreakerFailures, Section.BreakerCooldownMs
+	static RpcPolicy Load(const std::string& section);
+};
+
+//latency of the last Samples successful calls, the percentile is recomputed at most every 100ms
+class LatencyTracker
+{
+public:
+	LatencyTracker();
+	void Record(std::chrono::microseconds latency);
+	//zero until enough calls were seen
+	std::chrono::microseconds P95();
+private:
+	static constexpr std::size_t Samples = 256;
+	static constexpr std::size_t MinSamples = 32;
+
+	std::atomic<uint32_t> samples_[Samples];
+	std::atomic<std::size_t> count_;
+	std::atomic<long long> p95_;
+	std::atomic<long long> computedAt_;
+};
+
+//opens after breakerFailures failed calls in a row and rejects calls for the cooldown,
+//then lets a single probe through: success closes it, failure opens it again
+class CircuitBreaker
+{
+public:
+	CircuitBreaker(int failures, std::chrono::milliseconds cooldown);
+	bool Allow();
+	void Record(bool ok);
+	bool IsOpen() const;
+private:
+	const int threshold_;
+	const long long cooldown_;
+	std::atomic<int> failures_;
+	std::atomic<long long> openUntil_; //steady clock ms, 0 while closed
+	std::atomic<bool> probing_;
+};
@@ -0,0 +1,55 @@
+#include "RpcPoller.h"
+#include "ConfigMgr.h"
+#include "ioContextPool.h"
+#include <algorithm>
+
+using namespace std;
+
+RpcPoller::RpcPoller()
+	:next_(0)
+{
+	int threads = max(1, ConfigMgr::Instance().Get<int>("Rpc.PollerThreads", 2));
+	for (int i = 0; i < threads; ++i)
+	{
+		queues_.push_back(make_unique<grpc::CompletionQueue>());
+	}
+	for (auto& cq : queues_)
+	{
+		threads_.emplace_back(&RpcPoller::Poll, this, cq.get());
+	}
+}
+
+RpcPoller::~RpcPoller()
+{
+	for (auto& cq : queues_)
+	{
+		cq->Shutdown();
+	}
+	for (auto& thread : threads_)
+	{
+		if (thread.joinable()) thread.join();
+	}
+}
+
+grpc::CompletionQueue* RpcPoller::Queue()
+{
+	return queues_[next_++ % queues_.size()].get();
+}
+
+boost::asio::io_context& RpcPoller::CallerContext()
+{
+	int index = ioContextPool::CurrentIndex();
+	if (index >= 0) return ioContextPool::Instance().Context(index);
+	return ioContextPool::Instance().NextContext();
+}
+
+void RpcPoller::Poll(grpc::CompletionQueue* cq)
+{
+	void* tag;
+	bool ok;
+	//Next keeps returning the pending calls after Shutdown and fails once the queue is empty
+	while (cq->Next(&tag, &ok))
+	{
+		static_cast<RpcCall*>(tag)->Done(ok);
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <grpcpp/grpcpp.h>
+#include <boost/asio.hpp>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include "Singleton.ipp"
+
+//tag of an async rpc, Done runs on a poller thread once the call finished
+class RpcCall
+{
+public:
+	virtual ~RpcCall() = default;
+	virtual void Done(bool ok) = 0;
+};
+
+//a few threads drain the completion queues of every async client call,
+//results are handed back to the io threads so none of them waits on a backend
+class RpcPoller : public Singleton<RpcPoller>
+{
+	friend class Singleton<RpcPoller>;
+public:
+	~RpcPoller();
+	//queues are handed out round robin
+	grpc::CompletionQueue* Queue();
+	//io context of the calling pool thread, any pool context for other threads
+	static boost::asio::io_context& CallerContext();
+private:
+	RpcPoller();
+	void Poll(grpc::CompletionQueue* cq);
+
+	std::vector<std::unique_ptr<grpc::CompletionQueue>> queues_;
+	std::vector<std::thread> threads_;
+	std::atomic<std::size_t> next_;
+};
@@ -2,19 +2,21 @@
 #include <iostream>
 #include "Connection.h"
 #include "ioContextPool.h"
+#include "TlsContext.h"
 
 Server::Server(asio::io_context& ioc, unsigned int port)
 	:ioc_(ioc),
-	acceptor_(ioc, tcp::endpoint(tcp::v4(), port))
+	acceptor_(ioc, tcp::endpoint(tcp::v4(), port)),
+	tls_(TlsContext::Instance().Enabled() ? &TlsContext::Instance().Context() : nullptr)
 {
-	std::cout << "Runing in " << acceptor_.local_endpoint() << std::endl;
+	std::cout << "Runing in " << acceptor_.local_endpoint() << (tls_ ? " with tls" : "") << std::endl;
 }
 
 void Server::start()
 {
 	auto self = shared_from_this();
 	asio::io_context &NextContext = ioContextPool::Instance().NextContext();
-	std::shared_ptr<Connection> NewConnection = std::make_shared<Connection>(NextContext);
+	std::shared_ptr<Connection> NewConnection = std::make_shared<Connection>(NextContext, tls_);
 	acceptor_.async_accept(NewConnection->socket(), [self, NewConnection](const boost::system::error_code& ec) {
 		try {
 			//
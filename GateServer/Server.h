@@ -1,6 +1,7 @@
 #pragma once
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
+#include <boost/asio/ssl.hpp>
 
 namespace asio = boost::asio;
 namespace beast = boost::beast;
@@ -15,5 +16,7 @@ public:
 private:
 	tcp::acceptor acceptor_;
 	asio::io_context& ioc_;
+	//null when tls is off
+	asio::ssl::context* tls_;
 };
 
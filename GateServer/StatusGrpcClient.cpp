@@ -1,27 +1,132 @@
 #include "StatusGrpcClient.h"
 #include "ErrorCodes.h"
+#include "ConfigMgr.h"
+#include "RpcPoller.h"
+#include <algorithm>
 
-//TODO ʹӳ
+using namespace std;
 
 StatusGrpcClient::StatusGrpcClient()
+	:channels_(ConfigMgr::Instance().Get<string>("StatusServer.Address", "127.0.0.1:10087"),
+		ConfigMgr::Instance().Get<int>("StatusServer.Channels", 4),
+		ChannelPool<StatusService>::ParsePick(ConfigMgr::Instance().Get<string>("StatusServer.Pick", "round_robin")),
+		RpcPolicy::Load("StatusServer")),
+	batchSize_(ConfigMgr::Instance().Get<size_t>("StatusServer.BatchSize", 64)),
+	batchWindow_(ConfigMgr::Instance().Get<int>("StatusServer.BatchWindowUs", 500)),
+	running_(true)
 {
-	//TODO use config to load host
-	std::shared_ptr<Channel> channel = grpc::CreateChannel("127.0.0.1:10087", grpc::InsecureChannelCredentials());
-	stub_ = StatusService::NewStub(channel);
+	//batches are sent without waiting for the reply, one thread only gathers them
+	worker_ = thread(&StatusGrpcClient::BatchWorker, this);
 }
 
-GetStatusServiceRes StatusGrpcClient::GetChatServer(int uid)
+StatusGrpcClient::~StatusGrpcClient()
 {
-	ClientContext context;
-	GetStatusServiceReq req;
-	GetStatusServiceRes res;
-	req.set_uid(uid);
-	Status status = stub_->GetChatServer(&context, req, &res);
-	if (status.ok()) return res;
-	else
+	running_ = false;
+	cond_.notify_all();
+	if (worker_.joinable()) worker_.join();
+}
+
+void StatusGrpcClient::AsyncGetChatServer(int uid, Callback callback)
+{
+	auto& ioc = RpcPoller::CallerContext();
+	Enqueue(uid, [&ioc, callback = move(callback)](GetStatusServiceRes res) {
+		boost::asio::post(ioc, [callback, res = move(res)]() { callback(res); });
+	});
+}
+
+void StatusGrpcClient::Enqueue(int uid, Callback callback)
+{
+	size_t size;
+	{
+		lock_guard<mutex> lock(mutex_);
+		pending_.push_back(Lookup{ uid, move(callback), Tracer::Instance().Start(Tracer::Current(), "StatusGrpcClient GetChatServer") });
+		size = pending_.size();
+	}
+	//the first lookup starts a window, a full batch is sent right away
+	if (size == 1) cond_.notify_one();
+	else if (size >= batchSize_) cond_.notify_all();
+}
+
+void StatusGrpcClient::BatchWorker()
+{
+	vector<Lookup> lookups;
+	while (true)
+	{
+		{
+			unique_lock<mutex> lock(mutex_);
+			cond_.wait(lock, [this] { return !pending_.empty() || !running_; });
+			if (pending_.empty()) return;
+			//give concurrent logins a short window to join this batch
+			cond_.wait_for(lock, batchWindow_, [this] { return pending_.size() >= batchSize_ || !running_; });
+			if (pending_.size() <= batchSize_)
+			{
+				lookups.swap(pending_);
+			}
+			else
+			{
+				auto end = pending_.begin() + batchSize_;
+				lookups.assign(make_move_iterator(pending_.begin()), make_move_iterator(end));
+				pending_.erase(pending_.begin(), end);
+			}
+		}
+		SendBatch(move(lookups));
+		lookups.clear();
+	}
+}
+
+void StatusGrpcClient::SendBatch(std::vector<Lookup> lookups)
+{
+	//the rpc span hangs below the first sampled lookup, its id travels as traceparent metadata
+	auto& tracer = Tracer::Instance();
+	auto sampled = find_if(lookups.begin(), lookups.end(), [](const Lookup& lookup) { return lookup.span.context.Sampled(); });
+	TraceContext parent = sampled == lookups.end() ? TraceContext() : sampled->span.context;
+
+	//a lone lookup keeps the plain rpc
+	if (lookups.size() == 1)
+	{
+		GetStatusServiceReq req;
+		req.set_uid(lookups[0].uid);
+		TraceSpan rpc = tracer.Start(parent, "StatusService/GetChatServer", SpanKind::Client);
+		string traceparent = Tracer::Header(rpc.context);
+		channels_.AsyncCall<GetStatusServiceRes>([req, traceparent](StatusService::Stub& stub, ClientContext* context, grpc::CompletionQueue* cq) {
+			if (!traceparent.empty()) context->AddMetadata("traceparent", traceparent);
+			return stub.PrepareAsyncGetChatServer(context, req, cq);
+		}, [rpc, lookup = move(lookups[0])](const Status& status, GetStatusServiceRes& res) {
+			Tracer::Instance().End(rpc, status.error_message());
+			//deadline, open breaker or a dead backend all end up as RPCErr
+			if (!status.ok()) res.set_error(ErrorCodes::RPCErr);
+			Tracer::Instance().End(lookup.span, res.error() ? to_string(res.error()) : "");
+			lookup.callback(move(res));
+		});
+		return;
+	}
+
+	GetChatServersReq req;
+	for (auto& lookup : lookups)
 	{
-		res.set_error(ErrorCodes::RPCErr);
-		return res;
+		req.add_uids(lookup.uid);
 	}
-	return GetStatusServiceRes();
+	TraceSpan rpc = tracer.Start(parent, "StatusService/GetChatServers", SpanKind::Client);
+	string traceparent = Tracer::Header(rpc.context);
+	channels_.AsyncCall<GetChatServersRes>([req, traceparent](StatusService::Stub& stub, ClientContext* context, grpc::CompletionQueue* cq) {
+		if (!traceparent.empty()) context->AddMetadata("traceparent", traceparent);
+		return stub.PrepareAsyncGetChatServers(context, req, cq);
+	}, [rpc, lookups = move(lookups)](const Status& status, GetChatServersRes& res) {
+		Tracer::Instance().End(rpc, status.error_message());
+		int error = status.ok() ? res.error() : (int)ErrorCodes::RPCErr;
+		//one entry per uid in request order, anything else cannot be matched up
+		if (!error && res.servers_size() != (int)lookups.size()) error = ErrorCodes::RPCErr;
+		for (size_t i = 0; i < lookups.size(); ++i)
+		{
+			Tracer::Instance().End(lookups[i].span, error ? to_string(error) : "");
+			if (!error)
+			{
+				lookups[i].callback(res.servers((int)i));
+				continue;
+			}
+			GetStatusServiceRes failed;
+			failed.set_error(error);
+			lookups[i].callback(move(failed));
+		}
+	});
 }
@@ -1,7 +1,16 @@
 #pragma once
 #include "Singleton.ipp"
 #include "message.grpc.pb.h"
+#include "ChannelPool.h"
+#include "Tracer.h"
 #include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <atomic>
 #include <grpcpp/grpcpp.h>
 
 using grpc::ClientContext;
@@ -10,15 +19,42 @@ using grpc::Status;
 using message::StatusService;
 using message::GetStatusServiceReq;
 using message::GetStatusServiceRes;
+using message::GetChatServersReq;
+using message::GetChatServersRes;
 
 class StatusGrpcClient : public Singleton<StatusGrpcClient>
 {
 	friend class Singleton<StatusGrpcClient>;
 public:
-	~StatusGrpcClient() = default;
-	GetStatusServiceRes GetChatServer(int uid);
+	using Callback = std::function<void(GetStatusServiceRes)>;
+
+	~StatusGrpcClient();
+	//lookups from concurrent logins are gathered and sent as one GetChatServers call.
+	//never blocks, callback runs on the io context of the caller
+	void AsyncGetChatServer(int uid, Callback callback);
+	std::vector<ChannelStats> Stats() const { return channels_.Stats(); }
 private:
+	struct Lookup
+	{
+		int uid;
+		//runs on a poller thread
+		Callback callback;
+		//from Enqueue to the reply, batching wait included
+		TraceSpan span;
+	};
+
 	StatusGrpcClient();
-	std::unique_ptr<StatusService::Stub> stub_;
+	void Enqueue(int uid, Callback callback);
+	void BatchWorker();
+	void SendBatch(std::vector<Lookup> lookups);
+
+	ChannelPool<StatusService> channels_;
+	std::vector<Lookup> pending_;
+	std::mutex mutex_;
+	std::condition_variable cond_;
+	std::thread worker_;
+	std::size_t batchSize_;
+	std::chrono::microseconds batchWindow_;
+	std::atomic_bool running_;
 };
 
@@ -0,0 +1,135 @@
+#include "Throttle.h"
+#include "ConfigMgr.h"
+#include "RedisManager.h"
+#include "MysqlDao.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <cstdint>
+
+using namespace std;
+using namespace sw::redis;
+
+Throttle::Throttle()
+{
+	auto& config = ConfigMgr::Instance();
+	windowMs_ = max(1, config.Get<int>("Throttle.WindowSec", 60)) * 1000LL;
+	size_t shards = max(config.Get<size_t>("Throttle.Shards", 16), (size_t)1);
+	shards_ = vector<Shard>(shards);
+	shardCapacity_ = max(config.Get<size_t>("Throttle.MaxKeys", 100000) / shards, (size_t)1);
+	shared_ = config.Get<bool>("Throttle.Redis", false);
+	//a limit of 0 turns that check off
+	rules_["/login"] = Rule{ "user", config.Get<int>("Throttle.LoginPerIp", 30), config.Get<int>("Throttle.LoginPerUser", 10) };
+	rules_["/varify"] = Rule{ "email", config.Get<int>("Throttle.VarifyPerIp", 10), config.Get<int>("Throttle.VarifyPerEmail", 3) };
+	assert(AccountKey("/login", "user", "Bob") == AccountKey("/login", "user", "bOB"));
+}
+
+//mysql matches names and emails case-insensitively, so every spelling of one account shares a counter
+std::string Throttle::AccountKey(const std::string& path, const std::string& field, const std::string& account)
+{
+	return path + "|" + field + "|" + FoldKey(account);
+}
+
+const std::string* Throttle::AccountField(const std::string& path) const
+{
+	auto it = rules_.find(path);
+	if (it == rules_.end()) return nullptr;
+	return &it->second.field;
+}
+
+bool Throttle::Allow(const std::string& path, const std::string& ip, const std::string& account)
+{
+	auto it = rules_.find(path);
+	if (it == rules_.end()) return true;
+	const Rule& rule = it->second;
+	long long now = chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+	//wall clock windows line up across gates sharing counters through redis
+	long long window = now / windowMs_;
+	double elapsed = (double)(now % windowMs_) / windowMs_;
+	if (rule.perIp > 0 && !Hit(path + "|ip|" + ip, rule.perIp, window, elapsed)) return false;
+	if (rule.perAccount > 0 && !account.empty() && !Hit(AccountKey(path, rule.field, account), rule.perAccount, window, elapsed)) return false;
+	return true;
+}
+
+int Throttle::RetryAfter() const
+{
+	return (int)(windowMs_ / 1000);
+}
+
+bool Throttle::Hit(const std::string& key, int limit, long long window, double elapsed)
+{
+	Shard& shard = ShardOf(key);
+	{
+		lock_guard<mutex> lock(shard.mutex);
+		auto it = shard.index.find(key);
+		if (it != shard.index.end())
+		{
+			shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+		}
+		else
+		{
+			shard.lru.push_front(Entry{ key, Counter{ window, 0, 0 } });
+			shard.index[key] = shard.lru.begin();
+			if (shard.lru.size() > shardCapacity_)
+			{
+				shard.index.erase(shard.lru.back().key);
+				shard.lru.pop_back();
+			}
+		}
+		Counter& counter = shard.lru.front().counter;
+		if (counter.window != window)
+		{
+			counter.previous = counter.window == window - 1 ? counter.current : 0;
+			counter.current = 0;
+			counter.window = window;
+		}
+		//rejected requests are not counted, so a flood costs one lookup each and no redis traffic
+		if (counter.previous * (1.0 - elapsed) + counter.current >= limit) return false;
+		++counter.current;
+	}
+	if (shared_) Share(key, window);
+	return true;
+}
+
+void Throttle::Share(const std::string& key, long long window)
+{
+	string redisKey = "throttle:" + key + ":" + to_string(window);
+	long long ttl = windowMs_ * 2;
+	RedisManager::Instance().Batch(redisKey, [redisKey](Pipeline& pipe) { pipe.incr(redisKey); },
+		[this, key, redisKey, window, ttl](QueuedReplies& replies, size_t index) {
+			long long total = replies.get<long long>(index);
+			//the first increment created the key
+			if (total == 1)
+			{
+				RedisManager::Instance().Batch(redisKey, [redisKey, ttl](Pipeline& pipe) { pipe.pexpire(redisKey, ttl); },
+					[](QueuedReplies&, size_t) {}, [](exception_ptr) {});
+			}
+			Merge(key, window, (int)min<long long>(total, INT32_MAX));
+		},
+		[](exception_ptr e) {
+			//the local counters keep working without redis
+			try { rethrow_exception(e); }
+			catch (const exception& ex)
+			{
+				//TODO use log to print
+				cerr << "Throttle share failed: " << ex.what() << endl;
+			}
+		});
+}
+
+void Throttle::Merge(const std::string& key, long long window, int total)
+{
+	Shard& shard = ShardOf(key);
+	lock_guard<mutex> lock(shard.mutex);
+	auto it = shard.index.find(key);
+	if (it == shard.index.end()) return;
+	Counter& counter = it->second->counter;
+	if (counter.window == window) counter.current = max(counter.current, total);
+	else if (counter.window == window + 1) counter.previous = max(counter.previous, total);
+}
+
+Throttle::Shard& Throttle::ShardOf(const std::string& key)
+{
+	return shards_[hash<string>()(key) % shards_.size()];
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include "Singleton.ipp"
+
+//request limits per ip and per account for the paths open to brute force.
+//each key keeps the count of the current and the previous fixed window, the previous one is
+//weighted by how much of it still overlaps the sliding window ending now.
+//with Redis on, counts are also added up in redis and the totals of all gates flow back
+//asynchronously, a rejection never waits for redis
+class Throttle : public Singleton<Throttle>
+{
+	friend class Singleton<Throttle>;
+public:
+	~Throttle() = default;
+	//json field naming the account of a throttled path, nullptr for other paths
+	const std::string* AccountField(const std::string& path) const;
+	//counts the request and returns false once the ip or the account is over its limit
+	bool Allow(const std::string& path, const std::string& ip, const std::string& account);
+	int RetryAfter() const;
+private:
+	struct Rule
+	{
+		std::string field;
+		int perIp;
+		int perAccount;
+	};
+
+	struct Counter
+	{
+		long long window;
+		int previous;
+		int current;
+	};
+
+	struct Entry
+	{
+		std::string key;
+		Counter counter;
+	};
+
+	//at most shardCapacity_ keys, a new key past that drops the least recently hit one,
+	//so a spray of distinct keys costs one eviction per request and no scan
+	struct alignas(64) Shard
+	{
+		std::mutex mutex;
+		std::list<Entry> lru; //front is most recently hit
+		std::unordered_map<std::string, std::list<Entry>::iterator> index;
+	};
+
+	Throttle();
+	static std::string AccountKey(const std::string& path, const std::string& field, const std::string& account);
+	bool Hit(const std::string& key, int limit, long long window, double elapsed);
+	void Share(const std::string& key, long long window);
+	void Merge(const std::string& key, long long window, int total);
+	Shard& ShardOf(const std::string& key);
+
+	std::map<std::string, Rule> rules_;
+	std::vector<Shard> shards_;
+	long long windowMs_;
+	std::size_t shardCapacity_;
+	bool shared_;
+};
@@ -0,0 +1,199 @@
+#include "TlsContext.h"
+#include "ConfigMgr.h"
+#include <openssl/ssl.h>
+#include <openssl/rand.h>
+#include <openssl/hmac.h>
+#include <openssl/evp.h>
+#include <openssl/crypto.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <cstring>
+
+using namespace std;
+namespace ssl = boost::asio::ssl;
+
+//picks the key and iv for a ticket, returns the value openssl expects from the callback:
+//1 use the key, 2 use it and reissue the ticket, 0 unknown key (full handshake), -1 error
+static int TicketKeyFor(unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, int enc, TlsContext::TicketKey& key)
+{
+	auto& tls = TlsContext::Instance();
+	int result = 1;
+	if (enc)
+	{
+		key = tls.CurrentKey();
+		memcpy(name, key.name, sizeof(key.name));
+		if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1) return -1;
+	}
+	else
+	{
+		bool renew;
+		if (!tls.FindKey(name, key, renew)) return 0;
+		result = renew ? 2 : 1;
+	}
+	if (EVP_CipherInit_ex(cipher, EVP_aes_256_cbc(), nullptr, key.aes, iv, enc) != 1) return -1;
+	return result;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+static int TicketCallback(SSL*, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, EVP_MAC_CTX* mac, int enc)
+{
+	TlsContext::TicketKey key;
+	int result = TicketKeyFor(name, iv, cipher, enc, key);
+	if (result <= 0) return result;
+	OSSL_PARAM params[] = {
+		OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmac, sizeof(key.hmac)),
+		OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, (char*)"SHA256", 0),
+		OSSL_PARAM_construct_end()
+	};
+	if (EVP_MAC_CTX_set_params(mac, params) != 1) return -1;
+	return result;
+}
+#else
+static int TicketCallback(SSL*, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, HMAC_CTX* mac, int enc)
+{
+	TlsContext::TicketKey key;
+	int result = TicketKeyFor(name, iv, cipher, enc, key);
+	if (result <= 0) return result;
+	if (HMAC_Init_ex(mac, key.hmac, sizeof(key.hmac), EVP_sha256(), nullptr) != 1) return -1;
+	return result;
+}
+#endif
+
+TlsContext::TlsContext()
+	:context_(ssl::context::tls_server),
+	handshakes_(0),
+	resumed_(0)
+{
+	auto& config = ConfigMgr::Instance();
+	enabled_ = config.Get<bool>("Tls.Enabled", false);
+	rotateSec_ = max(60, config.Get<int>("Tls.TicketRotateSec", 3600));
+	if (enabled_) Configure();
+}
+
+void TlsContext::Configure()
+{
+	auto& config = ConfigMgr::Instance();
+	SSL_CTX* ctx = context_.native_handle();
+	context_.set_options(ssl::context::default_workarounds | ssl::context::no_sslv2 | ssl::context::no_sslv3
+		| ssl::context::no_tlsv1 | ssl::context::no_tlsv1_1 | ssl::context::single_dh_use);
+	SSL_CTX_set_min_proto_version(ctx, TLS1_2_VERSION);
+	//ecdhe only, ecdsa suites first: signing with P-256 costs a fraction of an rsa-2048 signature
+	SSL_CTX_set1_groups_list(ctx, "X25519:P-256");
+	SSL_CTX_set_cipher_list(ctx, "ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-ECDSA-CHACHA20-POLY1305:ECDHE-ECDSA-AES256-GCM-SHA384:"
+		"ECDHE-RSA-AES128-GCM-SHA256:ECDHE-RSA-CHACHA20-POLY1305:ECDHE-RSA-AES256-GCM-SHA384");
+	SSL_CTX_set_options(ctx, SSL_OP_CIPHER_SERVER_PREFERENCE);
+
+	context_.use_certificate_chain_file(config.Get<string>("Tls.CertFile", "gate.crt"));
+	context_.use_private_key_file(config.Get<string>("Tls.KeyFile", "gate.key"), ssl::context::pem);
+	if (EVP_PKEY_base_id(SSL_CTX_get0_privatekey(ctx)) != EVP_PKEY_EC)
+	{
+		//TODO use log to print
+		cerr << "Tls: the key is not ECDSA, full handshakes will cost more cpu" << endl;
+	}
+
+	//tls 1.2 clients without ticket support fall back to the session id cache
+	static const unsigned char sessionContext[] = "ks-gate";
+	SSL_CTX_set_session_id_context(ctx, sessionContext, sizeof(sessionContext) - 1);
+	SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+	SSL_CTX_sess_set_cache_size(ctx, max(1, config.Get<int>("Tls.SessionCacheSize", 20480)));
+	SSL_CTX_set_timeout(ctx, (long)rotateSec_ * 2);
+	//one ticket per connection is enough, every connection is short
+	SSL_CTX_set_num_tickets(ctx, 1);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx, TicketCallback);
+#else
+	SSL_CTX_set_tlsext_ticket_key_cb(ctx, TicketCallback);
+#endif
+
+	string secretFile = config.Get<string>("Tls.TicketSecretFile", "");
+	if (!secretFile.empty())
+	{
+		ifstream file(secretFile, ios::binary);
+		stringstream content;
+		content << file.rdbuf();
+		secret_ = content.str();
+	}
+	if (secret_.size() < 32)
+	{
+		//TODO use log to print
+		if (!secretFile.empty()) cerr << "Tls: ticket secret " << secretFile << " is missing or shorter than 32 bytes" << endl;
+		//tickets then only resume on this process
+		secret_.assign(48, '\0');
+		RAND_bytes((unsigned char*)&secret_[0], (int)secret_.size());
+	}
+}
+
+bool TlsContext::Enabled() const
+{
+	return enabled_;
+}
+
+boost::asio::ssl::context& TlsContext::Context()
+{
+	return context_;
+}
+
+TlsContext::TicketKey TlsContext::CurrentKey() const
+{
+	return KeyFor(CurrentPeriod());
+}
+
+bool TlsContext::FindKey(const unsigned char* name, TicketKey& key, bool& renew) const
+{
+	long long period = CurrentPeriod();
+	//the next period too, another gate's clock may be slightly ahead
+	for (long long candidate : { period, period - 1, period + 1 })
+	{
+		key = KeyFor(candidate);
+		if (CRYPTO_memcmp(key.name, name, sizeof(key.name)) == 0)
+		{
+			renew = candidate != period;
+			return true;
+		}
+	}
+	return false;
+}
+
+void TlsContext::Handshaked(bool resumed)
+{
+	handshakes_.fetch_add(1, memory_order_relaxed);
+	if (resumed) resumed_.fetch_add(1, memory_order_relaxed);
+}
+
+uint64_t TlsContext::Handshakes() const
+{
+	return handshakes_.load(memory_order_relaxed);
+}
+
+uint64_t TlsContext::Resumed() const
+{
+	return resumed_.load(memory_order_relaxed);
+}
+
+TlsContext::TicketKey TlsContext::KeyFor(long long period) const
+{
+	//name, aes and hmac keys are separate hmacs of the secret, the name reveals nothing about the keys
+	TicketKey key;
+	unsigned char out[EVP_MAX_MD_SIZE];
+	unsigned int len;
+	string label = "ks-ticket-name:" + to_string(period);
+	HMAC(EVP_sha256(), secret_.data(), (int)secret_.size(), (const unsigned char*)label.data(), label.size(), out, &len);
+	memcpy(key.name, out, sizeof(key.name));
+	label = "ks-ticket-keys:" + to_string(period);
+	HMAC(EVP_sha512(), secret_.data(), (int)secret_.size(), (const unsigned char*)label.data(), label.size(), out, &len);
+	memcpy(key.aes, out, sizeof(key.aes));
+	memcpy(key.hmac, out + sizeof(key.aes), sizeof(key.hmac));
+	return key;
+}
+
+long long TlsContext::CurrentPeriod() const
+{
+	//wall clock, so gates sharing the secret rotate together
+	return chrono::duration_cast<chrono::seconds>(chrono::system_clock::now().time_since_epoch()).count() / rotateSec_;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <boost/asio/ssl.hpp>
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include "Singleton.ipp"
+
+//the one ssl context shared by every io thread, so a ticket issued on one thread resumes on any other.
+//ticket keys are derived from a secret and the current rotation period: gates sharing TicketSecretFile
+//accept each other's tickets, and a ticket stays valid for the period after the one that issued it
+class TlsContext : public Singleton<TlsContext>
+{
+	friend class Singleton<TlsContext>;
+public:
+	struct TicketKey
+	{
+		unsigned char name[16];
+		unsigned char aes[32];
+		unsigned char hmac[32];
+	};
+
+	~TlsContext() = default;
+	bool Enabled() const;
+	boost::asio::ssl::context& Context();
+	//key for new tickets
+	TicketKey CurrentKey() const;
+	//key of a presented ticket, renew is set when the ticket should be reissued under the current key
+	bool FindKey(const unsigned char* name, TicketKey& key, bool& renew) const;
+	//counted after each finished handshake
+	void Handshaked(bool resumed);
+	uint64_t Handshakes() const;
+	uint64_t Resumed() const;
+private:
+	TlsContext();
+	void Configure();
+	TicketKey KeyFor(long long period) const;
+	long long CurrentPeriod() const;
+
+	bool enabled_;
+	boost::asio::ssl::context context_;
+	std::string secret_;
+	long long rotateSec_;
+	std::atomic<uint64_t> handshakes_;
+	std::atomic<uint64_t> resumed_;
+};
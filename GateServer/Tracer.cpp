@@ -0,0 +1,235 @@
+#include "Tracer.h"
+#include "ConfigMgr.h"
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+static thread_local TraceContext current;
+
+static mt19937_64& Engine()
+{
+	static thread_local mt19937_64 engine(random_device{}() ^ hash<thread::id>()(this_thread::get_id()));
+	return engine;
+}
+
+static string RandomHex(size_t bytes)
+{
+	static const char hex[] = "0123456789abcdef";
+	string out;
+	while (out.size() < bytes * 2)
+	{
+		uint64_t value = Engine()();
+		for (int i = 0; i < 16 && out.size() < bytes * 2; ++i, value >>= 4)
+		{
+			out.push_back(hex[value & 0x0f]);
+		}
+	}
+	return out;
+}
+
+static long long NowUs()
+{
+	return chrono::duration_cast<chrono::microseconds>(chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static bool IsHex(const string& str)
+{
+	return all_of(str.begin(), str.end(), [](char c) { return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'); });
+}
+
+//names and errors are ours or grpc's, only quotes, backslashes and control characters need care
+static void AppendJson(string& out, const string& str)
+{
+	out.push_back('"');
+	for (char c : str)
+	{
+		if (c == '"' || c == '\\') out.push_back('\\');
+		if ((unsigned char)c < 0x20) c = ' ';
+		out.push_back(c);
+	}
+	out.push_back('"');
+}
+
+Tracer::Tracer()
+	:second_(0),
+	sampled_(0),
+	queue_(max(ConfigMgr::Instance().Get<size_t>("Trace.QueueSize", 8192), (size_t)2)),
+	dropped_(0),
+	running_(true)
+{
+	auto& config = ConfigMgr::Instance();
+	enabled_ = config.Get<bool>("Trace.Enabled", false);
+	rate_ = min(max(config.Get<double>("Trace.SampleRate", 0.01), 0.0), 1.0);
+	maxPerSec_ = config.Get<int>("Trace.MaxPerSec", 100);
+	service_ = config.Get<string>("Trace.Service", "ks-chat");
+	string path = config.Get<string>("Trace.File", "trace.json");
+	if (enabled_)
+	{
+		file_.open(path, ios::app);
+		if (!file_)
+		{
+			//TODO use log to print
+			cerr << "Tracer: cannot open " << path << ", tracing is off" << endl;
+			enabled_ = false;
+		}
+	}
+	//nothing is ever queued while tracing is off
+	if (enabled_) thread_ = thread([this] { run(); });
+}
+
+Tracer::~Tracer()
+{
+	running_ = false;
+	if (thread_.joinable()) thread_.join();
+}
+
+TraceContext Tracer::Begin()
+{
+	TraceContext context;
+	if (!enabled_ || rate_ <= 0 || uniform_real_distribution<double>(0, 1)(Engine()) >= rate_) return context;
+	if (maxPerSec_ > 0)
+	{
+		long long second = NowUs() / 1000000;
+		long long last = second_.load(memory_order_relaxed);
+		if (last != second && second_.compare_exchange_strong(last, second)) sampled_.store(0, memory_order_relaxed);
+		if (sampled_.fetch_add(1, memory_order_relaxed) >= maxPerSec_) return context;
+	}
+	context.traceId = RandomHex(16);
+	return context;
+}
+
+TraceContext Tracer::Parse(const std::string& traceparent)
+{
+	TraceContext context;
+	//00-<32 hex>-<16 hex>-<2 hex>
+	if (traceparent.size() != 55 || traceparent[2] != '-' || traceparent[35] != '-' || traceparent[52] != '-') return context;
+	string traceId = traceparent.substr(3, 32);
+	string spanId = traceparent.substr(36, 16);
+	string flags = traceparent.substr(53, 2);
+	if (!IsHex(traceId) || !IsHex(spanId) || !IsHex(flags)) return context;
+	if (!(stoi(flags, nullptr, 16) & 1)) return context;
+	context.traceId = traceId;
+	context.spanId = spanId;
+	return context;
+}
+
+std::string Tracer::Header(const TraceContext& context)
+{
+	if (!context.Sampled()) return "";
+	return "00-" + context.traceId + "-" + context.spanId + "-01";
+}
+
+TraceSpan Tracer::Start(const TraceContext& parent, const std::string& name, SpanKind kind)
+{
+	TraceSpan span;
+	if (!enabled_ || !parent.Sampled()) return span;
+	span.context.traceId = parent.traceId;
+	span.context.spanId = RandomHex(8);
+	span.parentId = parent.spanId;
+	span.name = name;
+	span.kind = kind;
+	span.start = NowUs();
+	return span;
+}
+
+void Tracer::End(const TraceSpan& span, const std::string& error)
+{
+	if (!span.context.Sampled()) return;
+	if (!queue_.push(Finished{ span, NowUs() - span.start, error })) dropped_.fetch_add(1, memory_order_relaxed);
+}
+
+const TraceContext& Tracer::Current()
+{
+	return current;
+}
+
+void Tracer::SetCurrent(const TraceContext& context)
+{
+	current = context;
+}
+
+size_t Tracer::Dropped() const
+{
+	return dropped_.load(memory_order_relaxed);
+}
+
+void Tracer::run()
+{
+	Finished finished;
+	string line;
+	while (true)
+	{
+		bool stopping = !running_;
+		line.clear();
+		while (queue_.pop(finished))
+		{
+			line.push_back(line.empty() ? '[' : ',');
+			Write(finished, line);
+		}
+		if (!line.empty())
+		{
+			line += "]\n";
+			file_ << line;
+			file_.flush();
+		}
+		if (stopping) return;
+		this_thread::sleep_for(chrono::milliseconds(100));
+	}
+}
+
+void Tracer::Write(const Finished& finished, std::string& line)
+{
+	const TraceSpan& span = finished.span;
+	line += "{\"traceId\":\"" + span.context.traceId + "\",\"id\":\"" + span.context.spanId + "\"";
+	if (!span.parentId.empty()) line += ",\"parentId\":\"" + span.parentId + "\"";
+	if (span.kind == SpanKind::Server) line += ",\"kind\":\"SERVER\"";
+	else if (span.kind == SpanKind::Client) line += ",\"kind\":\"CLIENT\"";
+	line += ",\"name\":";
+	AppendJson(line, span.name);
+	line += ",\"timestamp\":" + to_string(span.start) + ",\"duration\":" + to_string(max(finished.duration, 1LL));
+	line += ",\"localEndpoint\":{\"serviceName\":";
+	AppendJson(line, service_);
+	line += "}";
+	if (!finished.error.empty())
+	{
+		line += ",\"tags\":{\"error\":";
+		AppendJson(line, finished.error);
+		line += "}";
+	}
+	line += "}";
+}
+
+TraceScope::TraceScope(const TraceContext& context)
+	:previous_(Tracer::Current())
+{
+	Tracer::SetCurrent(context);
+}
+
+TraceScope::~TraceScope()
+{
+	Tracer::SetCurrent(previous_);
+}
+
+ScopedSpan::ScopedSpan(const std::string& name, SpanKind kind)
+	:ScopedSpan(Tracer::Current(), name, kind)
+{
+}
+
+ScopedSpan::ScopedSpan(const TraceContext& parent, const std::string& name, SpanKind kind)
+	:span_(Tracer::Instance().Start(parent, name, kind)),
+	scope_(span_.context.Sampled() ? span_.context : parent)
+{
+}
+
+ScopedSpan::~ScopedSpan()
+{
+	Tracer::Instance().End(span_, error_);
+}
+
+void ScopedSpan::Fail(const std::string& error)
+{
+	error_ = error;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <string>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include "Singleton.ipp"
+#include "LockFreeQueue.h"
+
+//position in a trace, an empty traceId means the request is not sampled
+struct TraceContext
+{
+	std::string traceId; //32 hex digits
+	std::string spanId; //16 hex digits, empty for the root
+	bool Sampled() const { return !traceId.empty(); }
+};
+
+enum class SpanKind
+{
+	Internal,
+	Server,
+	Client,
+};
+
+//an open span, copyable so async callbacks can carry it until End
+struct TraceSpan
+{
+	TraceContext context;
+	std::string parentId;
+	std::string name;
+	SpanKind kind = SpanKind::Internal;
+	long long start = 0; //microseconds since epoch
+};
+
+//span tracing with w3c traceparent propagation. Finished spans go into a lock free queue
+//(dropped when it is full) and are appended to Trace.File by one thread as zipkin v2 json,
+//one array per line, which a zipkin collector accepts as is
+class Tracer : public Singleton<Tracer>
+{
+	friend class Singleton<Tracer>;
+public:
+	~Tracer();
+	//root of a new trace, sampled at SampleRate and at most MaxPerSec traces a second.
+	//for the public edge: a traceparent sent by clients is not looked at, so they cannot force sampling.
+	//services behind it continue the caller's trace with Parse instead
+	TraceContext Begin();
+	//"00-<trace id>-<span id>-<flags>", malformed or unsampled gives an unsampled context
+	static TraceContext Parse(const std::string& traceparent);
+	static std::string Header(const TraceContext& context);
+	//child of parent, inert when parent is not sampled
+	TraceSpan Start(const TraceContext& parent, const std::string& name, SpanKind kind = SpanKind::Internal);
+	//a non empty error is recorded as the error tag
+	void End(const TraceSpan& span, const std::string& error = "");
+	//context of the request the calling thread works on
+	static const TraceContext& Current();
+	static void SetCurrent(const TraceContext& context);
+	size_t Dropped() const;
+private:
+	struct Finished
+	{
+		TraceSpan span;
+		long long duration;
+		std::string error;
+	};
+
+	Tracer();
+	void run();
+	void Write(const Finished& finished, std::string& line);
+
+	bool enabled_;
+	double rate_;
+	int maxPerSec_;
+	std::atomic<long long> second_;
+	std::atomic<int> sampled_;
+	std::string service_;
+	std::ofstream file_;
+	LockFreeQueue<Finished> queue_;
+	std::atomic<size_t> dropped_;
+	std::atomic_bool running_;
+	std::thread thread_;
+};
+
+//makes context current on the calling thread until the scope ends
+class TraceScope
+{
+public:
+	explicit TraceScope(const TraceContext& context);
+	~TraceScope();
+	TraceScope(const TraceScope&) = delete;
+	TraceScope& operator= (const TraceScope&) = delete;
+private:
+	TraceContext previous_;
+};
+
+//times a synchronous block as a child of the current context, nested calls become its children
+class ScopedSpan
+{
+public:
+	explicit ScopedSpan(const std::string& name, SpanKind kind = SpanKind::Internal);
+	ScopedSpan(const TraceContext& parent, const std::string& name, SpanKind kind = SpanKind::Internal);
+	~ScopedSpan();
+	ScopedSpan(const ScopedSpan&) = delete;
+	ScopedSpan& operator= (const ScopedSpan&) = delete;
+	void Fail(const std::string& error);
+	const TraceContext& Context() const { return span_.context; }
+private:
+	TraceSpan span_;
+	TraceScope scope_;
+	std::string error_;
+};
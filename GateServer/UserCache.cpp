@@ -0,0 +1,71 @@
+#include "UserCache.h"
+
+using namespace std;
+
+UserCache::UserCache(std::size_t capacity, std::chrono::milliseconds ttl, std::chrono::milliseconds negativeTtl, std::size_t shards)
+	:shards_(shards),
+	shardCapacity_(capacity / shards + 1),
+	ttl_(ttl),
+	negativeTtl_(negativeTtl)
+{}
+
+bool UserCache::Get(const std::string& user, UserInfo& userInfo, bool& found, uint64_t& version)
+{
+	string name = FoldKey(user);
+	Shard& shard = ShardOf(name);
+	lock_guard<mutex> lock(shard.mutex);
+	version = shard.version;
+	auto it = shard.index.find(name);
+	if (it == shard.index.end()) return false;
+	if (it->second->expire <= Clock::now())
+	{
+		shard.lru.erase(it->second);
+		shard.index.erase(it);
+		return false;
+	}
+	shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+	found = it->second->found;
+	if (found) userInfo = it->second->userInfo;
+	return true;
+}
+
+void UserCache::Put(const std::string& user, const UserInfo* userInfo, uint64_t version)
+{
+	string name = FoldKey(user);
+	Shard& shard = ShardOf(name);
+	lock_guard<mutex> lock(shard.mutex);
+	//invalidated while the row was in flight
+	if (shard.version != version) return;
+	Entry entry{ name, userInfo != nullptr, userInfo ? *userInfo : UserInfo(), Clock::now() + (userInfo ? ttl_ : negativeTtl_) };
+	auto it = shard.index.find(name);
+	if (it != shard.index.end())
+	{
+		*it->second = move(entry);
+		shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+		return;
+	}
+	shard.lru.push_front(move(entry));
+	shard.index[name] = shard.lru.begin();
+	if (shard.lru.size() > shardCapacity_)
+	{
+		shard.index.erase(shard.lru.back().name);
+		shard.lru.pop_back();
+	}
+}
+
+void UserCache::Invalidate(const std::string& user)
+{
+	string name = FoldKey(user);
+	Shard& shard = ShardOf(name);
+	lock_guard<mutex> lock(shard.mutex);
+	++shard.version;
+	auto it = shard.index.find(name);
+	if (it == shard.index.end()) return;
+	shard.lru.erase(it->second);
+	shard.index.erase(it);
+}
+
+UserCache::Shard& UserCache::ShardOf(const std::string& name)
+{
+	return shards_[hash<string>()(name) % shards_.size()];
+}
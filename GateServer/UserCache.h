@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include "MysqlDao.h"
+
+//login lookups by username, sharded LRU with a short ttl per entry.
+//unknown names are cached too (negative entries, with their own shorter ttl) so bots
+//probing random names do not reach mysql. Names are folded with FoldKey, as mysql matched them.
+//every invalidation bumps the shard's version, Put is ignored when the version changed since
+//the Get that missed, so a row read before a write landed is not stored
+class UserCache
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	UserCache(std::size_t capacity, std::chrono::milliseconds ttl, std::chrono::milliseconds negativeTtl, std::size_t shards = 16);
+
+	//returns false on miss and hands out the version to pass back to Put,
+	//on a hit found tells whether the user exists
+	bool Get(const std::string& name, UserInfo& userInfo, bool& found, uint64_t& version);
+	void Put(const std::string& name, const UserInfo* userInfo, uint64_t version);
+	void Invalidate(const std::string& name);
+private:
+	struct Entry
+	{
+		std::string name;
+		bool found;
+		UserInfo userInfo;
+		Clock::time_point expire;
+	};
+
+	struct Shard
+	{
+		std::mutex mutex;
+		std::list<Entry> lru; //front is most recently used
+		std::unordered_map<std::string, std::list<Entry>::iterator> index;
+		uint64_t version = 0;
+	};
+
+	Shard& ShardOf(const std::string& name);
+
+	std::vector<Shard> shards_;
+	std::size_t shardCapacity_;
+	std::chrono::milliseconds ttl_;
+	std::chrono::milliseconds negativeTtl_;
+};
@@ -0,0 +1,85 @@
+#include "UserFilter.h"
+#include "ConfigMgr.h"
+#include "MysqlDao.h"
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+static const int LoadChunk = 10000;
+
+UserFilter::UserFilter()
+	:lastId_(0),
+	running_(true)
+{
+	auto& config = ConfigMgr::Instance();
+	size_t expected = config.Get<size_t>("Filter.ExpectedUsers", 1000000);
+	double falsePositive = config.Get<double>("Filter.FalsePositive", 0.001);
+	refresh_ = chrono::seconds(max(1, config.Get<int>("Filter.RefreshSec", 30)));
+	//leave room for growth, the filter cannot be resized once filled
+	int maxId = MysqlDao::Instance().MaxUserId();
+	expected = max(expected, (size_t)max(maxId, 0) * 2);
+	names_.reset(new BloomFilter(expected, falsePositive));
+	emails_.reset(new BloomFilter(expected, falsePositive));
+	Load();
+	//Debug
+	cout << "user filter loaded up to id " << lastId_ << ", " << names_->Bytes() * 2 / 1024 << " KB" << endl;
+	thread_ = thread([this] { run(); });
+}
+
+UserFilter::~UserFilter()
+{
+	{
+		lock_guard<mutex> lock(mutex_);
+		running_ = false;
+	}
+	cond_.notify_all();
+	if (thread_.joinable()) thread_.join();
+}
+
+bool UserFilter::MayContainName(const std::string& name) const
+{
+	return names_->MayContain(FoldKey(name));
+}
+
+bool UserFilter::MayContainEmail(const std::string& email) const
+{
+	return emails_->MayContain(FoldKey(email));
+}
+
+void UserFilter::Add(const std::string& name, const std::string& email)
+{
+	names_->Add(FoldKey(name));
+	emails_->Add(FoldKey(email));
+}
+
+bool UserFilter::Load()
+{
+	//keyset pages keep every query short however large the table is
+	while (true)
+	{
+		int last = MysqlDao::Instance().LoadUsers(lastId_, LoadChunk, [this](const string& name, const string& email) {
+			Add(name, email);
+		});
+		if (last < 0) return false;
+		if (last == lastId_) return true;
+		lastId_ = last;
+	}
+}
+
+void UserFilter::run()
+{
+	unique_lock<mutex> lock(mutex_);
+	while (running_)
+	{
+		cond_.wait_for(lock, refresh_, [this] { return !running_; });
+		if (!running_) return;
+		lock.unlock();
+		if (!Load())
+		{
+			//TODO use log to print
+			cerr << "user filter refresh failed after id " << lastId_ << endl;
+		}
+		lock.lock();
+	}
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include "Singleton.ipp"
+#include "BloomFilter.h"
+
+//bloom filters of the taken usernames and emails, bulk loaded from mysql on first use
+//and topped up with rows added since then, so other gates' registrations show up too.
+//a miss means the name is free as far as this gate has seen. Keys go in folded like mysql compares them
+class UserFilter : public Singleton<UserFilter>
+{
+	friend class Singleton<UserFilter>;
+public:
+	~UserFilter();
+	bool MayContainName(const std::string& name) const;
+	bool MayContainEmail(const std::string& email) const;
+	//called after a registration succeeded
+	void Add(const std::string& name, const std::string& email);
+private:
+	UserFilter();
+	//loads the rows after lastId_, returns false when mysql failed
+	bool Load();
+	void run();
+
+	std::unique_ptr<BloomFilter> names_;
+	std::unique_ptr<BloomFilter> emails_;
+	int lastId_;
+	std::chrono::seconds refresh_;
+	std::mutex mutex_;
+	std::condition_variable cond_;
+	std::atomic_bool running_;
+	std::thread thread_;
+};
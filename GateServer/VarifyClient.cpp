@@ -1,5 +1,8 @@
 #include "VarifyClient.h"
 #include "ErrorCodes.h"
+#include "ConfigMgr.h"
+#include "RpcPoller.h"
+#include <algorithm>
 
 std::shared_ptr<VarifyClient> VarifyClient::instance_ = nullptr;
 
@@ -7,9 +10,15 @@ std::shared_ptr<VarifyClient> VarifyClient::instance_ = nullptr;
 //Ӷ֧߳
 
 VarifyClient::VarifyClient()
+    :channels_(ConfigMgr::Instance().Get<std::string>("VarifyServer.Address", "127.0.0.1:10086"),
+        ConfigMgr::Instance().Get<int>("VarifyServer.Channels", 4),
+        ChannelPool<Varify>::ParsePick(ConfigMgr::Instance().Get<std::string>("VarifyServer.Pick", "round_robin")),
+        RpcPolicy::Load("VarifyServer")),
+    shards_(16),
+    shardCapacity_(std::max<size_t>(ConfigMgr::Instance().Get<size_t>("VarifyServer.MaxRecent", 65536) / 16, 1)),
+    resendWindow_(ConfigMgr::Instance().Get<int>("VarifyServer.ResendWindowMs", 60000)),
+    failureWindow_(ConfigMgr::Instance().Get<int>("VarifyServer.FailureWindowMs", 2000))
 {
-    std::shared_ptr<Channel> channel = grpc::CreateChannel("127.0.0.1:10086", grpc::InsecureChannelCredentials());
-    stub_ = Varify::NewStub(channel);
 }
 
 std::shared_ptr<VarifyClient> VarifyClient::GetInstance()
@@ -21,18 +30,70 @@ std::shared_ptr<VarifyClient> VarifyClient::GetInstance()
     return instance_;
 }
 
-VarifyRes VarifyClient::GetVarifyCode(std::string email)
+void VarifyClient::AsyncGetVarifyCode(std::string email, std::function<void(VarifyRes)> callback)
 {
-    ClientContext context;
+    auto& ioc = RpcPoller::CallerContext();
+    Shard& shard = ShardOf(email);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto recent = shard.index.find(email);
+        if (recent != shard.index.end() && recent->second->expire > Clock::now())
+        {
+            //the code was just sent, do not mail it again
+            boost::asio::post(ioc, [callback = std::move(callback), res = recent->second->res]() { callback(res); });
+            return;
+        }
+        auto flight = shard.flights.find(email);
+        if (flight != shard.flights.end())
+        {
+            flight->second.push_back(Waiter{ &ioc, std::move(callback) });
+            return;
+        }
+        shard.flights[email].push_back(Waiter{ &ioc, std::move(callback) });
+    }
+
     VarifyReq request;
-    VarifyRes response;
     request.set_email(email);
-    Status status = stub_->GetVarifyCode(&context, request, &response);
-    if (status.ok()) {
-        response.set_error(ErrorCodes::SUCCESS);
+    channels_.AsyncCall<VarifyRes>([request](Varify::Stub& stub, ClientContext* context, grpc::CompletionQueue* cq) {
+        return stub.PrepareAsyncGetVarifyCode(context, request, cq);
+    }, [this, email](const Status& status, VarifyRes& response) {
+        //a reply from VerifyServer keeps its own error (RedisErr, Exception), only a failed call is RPCErr
+        if (!status.ok()) response.set_error(ErrorCodes::RPCErr);
+        Land(email, std::move(response));
+    });
+}
+
+VarifyClient::Shard& VarifyClient::ShardOf(const std::string& email)
+{
+    return shards_[std::hash<std::string>()(email) % shards_.size()];
+}
+
+void VarifyClient::Land(const std::string& email, VarifyRes res)
+{
+    std::vector<Waiter> waiters;
+    Shard& shard = ShardOf(email);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto flight = shard.flights.find(email);
+        if (flight != shard.flights.end())
+        {
+            waiters.swap(flight->second);
+            shard.flights.erase(flight);
+        }
+        Clock::time_point now = Clock::now();
+        auto recent = shard.index.find(email);
+        if (recent != shard.index.end()) shard.recent.erase(recent->second);
+        shard.recent.push_front(Recent{ email, res, now + (res.error() == ErrorCodes::SUCCESS ? resendWindow_ : failureWindow_) });
+        shard.index[email] = shard.recent.begin();
+        //the oldest reply goes first, it is also the one closest to expiring
+        if (shard.recent.size() > shardCapacity_)
+        {
+            shard.index.erase(shard.recent.back().email);
+            shard.recent.pop_back();
+        }
     }
-    else {
-        response.set_error(ErrorCodes::RPCErr);
+    for (auto& waiter : waiters)
+    {
+        boost::asio::post(*waiter.ioc, [callback = std::move(waiter.callback), res]() { callback(res); });
     }
-    return response;
 }
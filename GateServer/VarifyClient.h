@@ -1,8 +1,16 @@
 #pragma once
 #include <memory>
 #include <mutex>
+#include <functional>
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <chrono>
+#include <boost/asio.hpp>
 #include <grpcpp/grpcpp.h>
 #include "message.grpc.pb.h"
+#include "ChannelPool.h"
 
 using grpc::ClientContext;
 using grpc::Channel;
@@ -16,12 +24,45 @@ class VarifyClient
 public:
 	~VarifyClient() = default;
 	static std::shared_ptr<VarifyClient> GetInstance();
-	VarifyRes GetVarifyCode(std::string email);
+	//never blocks, callback runs on the io context of the caller.
+	//concurrent requests for one email share a single rpc, and its reply answers
+	//repeats for the resend window (failures only briefly)
+	void AsyncGetVarifyCode(std::string email, std::function<void(VarifyRes)> callback);
+	std::vector<ChannelStats> Stats() const { return channels_.Stats(); }
 private:
+	using Clock = std::chrono::steady_clock;
+
+	struct Waiter
+	{
+		boost::asio::io_context* ioc;
+		std::function<void(VarifyRes)> callback;
+	};
+
+	struct Recent
+	{
+		std::string email;
+		VarifyRes res;
+		Clock::time_point expire;
+	};
+
+	struct Shard
+	{
+		std::mutex mutex;
+		std::unordered_map<std::string, std::vector<Waiter>> flights; //rpcs in flight
+		std::list<Recent> recent; //front is the latest reply, the back is dropped past shardCapacity_
+		std::unordered_map<std::string, std::list<Recent>::iterator> index;
+	};
+
 	VarifyClient();
 	VarifyClient(const VarifyClient&) = delete;
 	VarifyClient& operator = (const VarifyClient&) = delete;
+	Shard& ShardOf(const std::string& email);
+	void Land(const std::string& email, VarifyRes res);
 	static std::shared_ptr<VarifyClient> instance_;
-	std::unique_ptr<Varify::Stub> stub_;
+	ChannelPool<Varify> channels_;
+	std::vector<Shard> shards_;
+	size_t shardCapacity_;
+	std::chrono::milliseconds resendWindow_;
+	std::chrono::milliseconds failureWindow_;
 };
 
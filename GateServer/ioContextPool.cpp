@@ -1,5 +1,8 @@
 #include "ioContextPool.h"
 #include <iostream>
+
+static thread_local int ThreadIndex = -1;
+
 ioContextPool::ioContextPool(int num)
 	:ioContexts_(num),
 	works_(num),
@@ -13,6 +16,7 @@ ioContextPool::ioContextPool(int num)
 	for (int i = 0; i < num; ++i)
 	{
 		threads_.emplace_back([this, i]() {
+			ThreadIndex = i;
 			ioContexts_.at(i).run();
 			});
 	}
@@ -30,6 +34,21 @@ boost::asio::io_context& ioContextPool::NextContext()
 	return context;
 }
 
+boost::asio::io_context& ioContextPool::Context(std::size_t index)
+{
+	return ioContexts_[index];
+}
+
+std::size_t ioContextPool::size() const
+{
+	return ioContexts_.size();
+}
+
+int ioContextPool::CurrentIndex()
+{
+	return ThreadIndex;
+}
+
 void ioContextPool::stop()
 {
 	if (running_)
@@ -18,6 +18,10 @@ public:
 	~ioContextPool();
 
 	ioContext& NextContext();
+	ioContext& Context(std::size_t index);
+	std::size_t size() const;
+	//index of the pool thread running the caller, -1 for other threads
+	static int CurrentIndex();
 
 private:
 	void stop();
@@ -84,6 +84,10 @@ Varify::Service::~Service() {
 
 static const char* StatusService_method_names[] = {
   "/message.StatusService/GetChatServer",
+  "/message.StatusService/RegisterChatServer",
+  "/message.StatusService/Heartbeat",
+  "/message.StatusService/DeregisterChatServer",
+  "/message.StatusService/GetChatServers",
 };
 
 std::unique_ptr< StatusService::Stub> StatusService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -94,6 +98,10 @@ std::unique_ptr< StatusService::Stub> StatusService::NewStub(const std::shared_p
 
 StatusService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
   : channel_(channel), rpcmethod_GetChatServer_(StatusService_method_names[0], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_RegisterChatServer_(StatusService_method_names[1], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Heartbeat_(StatusService_method_names[2], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_DeregisterChatServer_(StatusService_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetChatServers_(StatusService_method_names[4], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status StatusService::Stub::GetChatServer(::grpc::ClientContext* context, const ::message::GetStatusServiceReq& request, ::message::GetStatusServiceRes* response) {
@@ -119,6 +127,98 @@ void StatusService::Stub::experimental_async::GetChatServer(::grpc::ClientContex
   return result;
 }
 
+::grpc::Status StatusService::Stub::RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_RegisterChatServer_, context, request, response);
+}
+
+void StatusService::Stub::experimental_async::RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RegisterChatServer_, context, request, response, std::move(f));
+}
+
+void StatusService::Stub::experimental_async::RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_RegisterChatServer_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* StatusService::Stub::PrepareAsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::ChatServerRes, ::message::ChatServerReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_RegisterChatServer_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* StatusService::Stub::AsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncRegisterChatServerRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status StatusService::Stub::Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Heartbeat_, context, request, response);
+}
+
+void StatusService::Stub::experimental_async::Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Heartbeat_, context, request, response, std::move(f));
+}
+
+void StatusService::Stub::experimental_async::Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Heartbeat_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* StatusService::Stub::PrepareAsyncHeartbeatRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::ChatServerRes, ::message::ChatServerReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Heartbeat_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* StatusService::Stub::AsyncHeartbeatRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncHeartbeatRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status StatusService::Stub::DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_DeregisterChatServer_, context, request, response);
+}
+
+void StatusService::Stub::experimental_async::DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_DeregisterChatServer_, context, request, response, std::move(f));
+}
+
+void StatusService::Stub::experimental_async::DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_DeregisterChatServer_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* StatusService::Stub::PrepareAsyncDeregisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::ChatServerRes, ::message::ChatServerReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_DeregisterChatServer_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* StatusService::Stub::AsyncDeregisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncDeregisterChatServerRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status StatusService::Stub::GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::message::GetChatServersRes* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::message::GetChatServersReq, ::message::GetChatServersRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetChatServers_, context, request, response);
+}
+
+void StatusService::Stub::experimental_async::GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::message::GetChatServersReq, ::message::GetChatServersRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetChatServers_, context, request, response, std::move(f));
+}
+
+void StatusService::Stub::experimental_async::GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetChatServers_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::GetChatServersRes>* StatusService::Stub::PrepareAsyncGetChatServersRaw(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::message::GetChatServersRes, ::message::GetChatServersReq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetChatServers_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::message::GetChatServersRes>* StatusService::Stub::AsyncGetChatServersRaw(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetChatServersRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 StatusService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       StatusService_method_names[0],
@@ -130,6 +230,46 @@ StatusService::Service::Service() {
              ::message::GetStatusServiceRes* resp) {
                return service->GetChatServer(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StatusService_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](StatusService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::ChatServerReq* req,
+             ::message::ChatServerRes* resp) {
+               return service->RegisterChatServer(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StatusService_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](StatusService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::ChatServerReq* req,
+             ::message::ChatServerRes* resp) {
+               return service->Heartbeat(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StatusService_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::message::ChatServerReq, ::message::ChatServerRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](StatusService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::ChatServerReq* req,
+             ::message::ChatServerRes* resp) {
+               return service->DeregisterChatServer(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      StatusService_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< StatusService::Service, ::message::GetChatServersReq, ::message::GetChatServersRes, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](StatusService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::message::GetChatServersReq* req,
+             ::message::GetChatServersRes* resp) {
+               return service->GetChatServers(ctx, req, resp);
+             }, this)));
 }
 
 StatusService::Service::~Service() {
@@ -142,6 +282,34 @@ StatusService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status StatusService::Service::RegisterChatServer(::grpc::ServerContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status StatusService::Service::Heartbeat(::grpc::ServerContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status StatusService::Service::DeregisterChatServer(::grpc::ServerContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status StatusService::Service::GetChatServers(::grpc::ServerContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace message
 
@@ -301,6 +301,34 @@ class StatusService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::GetStatusServiceRes>> PrepareAsyncGetChatServer(::grpc::ClientContext* context, const ::message::GetStatusServiceReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::GetStatusServiceRes>>(PrepareAsyncGetChatServerRaw(context, request, cq));
     }
+    virtual ::grpc::Status RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>> AsyncRegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>>(AsyncRegisterChatServerRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>> PrepareAsyncRegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>>(PrepareAsyncRegisterChatServerRaw(context, request, cq));
+    }
+    virtual ::grpc::Status Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>> AsyncHeartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>>(AsyncHeartbeatRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>> PrepareAsyncHeartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>>(PrepareAsyncHeartbeatRaw(context, request, cq));
+    }
+    virtual ::grpc::Status DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>> AsyncDeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>>(AsyncDeregisterChatServerRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>> PrepareAsyncDeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>>(PrepareAsyncDeregisterChatServerRaw(context, request, cq));
+    }
+    virtual ::grpc::Status GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::message::GetChatServersRes* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::GetChatServersRes>> AsyncGetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::GetChatServersRes>>(AsyncGetChatServersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::GetChatServersRes>> PrepareAsyncGetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::message::GetChatServersRes>>(PrepareAsyncGetChatServersRaw(context, request, cq));
+    }
     class experimental_async_interface {
      public:
       virtual ~experimental_async_interface() {}
@@ -310,6 +338,30 @@ class StatusService final {
       #else
       virtual void GetChatServer(::grpc::ClientContext* context, const ::message::GetStatusServiceReq* request, ::message::GetStatusServiceRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      virtual void RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
     };
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     typedef class experimental_async_interface async_interface;
@@ -321,6 +373,14 @@ class StatusService final {
   private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::GetStatusServiceRes>* AsyncGetChatServerRaw(::grpc::ClientContext* context, const ::message::GetStatusServiceReq& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::GetStatusServiceRes>* PrepareAsyncGetChatServerRaw(::grpc::ClientContext* context, const ::message::GetStatusServiceReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>* AsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>* PrepareAsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>* AsyncHeartbeatRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>* PrepareAsyncHeartbeatRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>* AsyncDeregisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::ChatServerRes>* PrepareAsyncDeregisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::GetChatServersRes>* AsyncGetChatServersRaw(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::message::GetChatServersRes>* PrepareAsyncGetChatServersRaw(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -332,6 +392,34 @@ class StatusService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::GetStatusServiceRes>> PrepareAsyncGetChatServer(::grpc::ClientContext* context, const ::message::GetStatusServiceReq& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::GetStatusServiceRes>>(PrepareAsyncGetChatServerRaw(context, request, cq));
     }
+    ::grpc::Status RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>> AsyncRegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>>(AsyncRegisterChatServerRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>> PrepareAsyncRegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>>(PrepareAsyncRegisterChatServerRaw(context, request, cq));
+    }
+    ::grpc::Status Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>> AsyncHeartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>>(AsyncHeartbeatRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>> PrepareAsyncHeartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>>(PrepareAsyncHeartbeatRaw(context, request, cq));
+    }
+    ::grpc::Status DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::message::ChatServerRes* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>> AsyncDeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>>(AsyncDeregisterChatServerRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>> PrepareAsyncDeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>>(PrepareAsyncDeregisterChatServerRaw(context, request, cq));
+    }
+    ::grpc::Status GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::message::GetChatServersRes* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::GetChatServersRes>> AsyncGetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::GetChatServersRes>>(AsyncGetChatServersRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::GetChatServersRes>> PrepareAsyncGetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::message::GetChatServersRes>>(PrepareAsyncGetChatServersRaw(context, request, cq));
+    }
     class experimental_async final :
       public StubInterface::experimental_async_interface {
      public:
@@ -341,6 +429,30 @@ class StatusService final {
       #else
       void GetChatServer(::grpc::ClientContext* context, const ::message::GetStatusServiceReq* request, ::message::GetStatusServiceRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      void RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void RegisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void Heartbeat(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void DeregisterChatServer(::grpc::ClientContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void GetChatServers(::grpc::ClientContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
      private:
       friend class Stub;
       explicit experimental_async(Stub* stub): stub_(stub) { }
@@ -354,7 +466,19 @@ class StatusService final {
     class experimental_async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::message::GetStatusServiceRes>* AsyncGetChatServerRaw(::grpc::ClientContext* context, const ::message::GetStatusServiceReq& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::message::GetStatusServiceRes>* PrepareAsyncGetChatServerRaw(::grpc::ClientContext* context, const ::message::GetStatusServiceReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* AsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* PrepareAsyncRegisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* AsyncHeartbeatRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* PrepareAsyncHeartbeatRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* AsyncDeregisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::message::ChatServerRes>* PrepareAsyncDeregisterChatServerRaw(::grpc::ClientContext* context, const ::message::ChatServerReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::message::GetChatServersRes>* AsyncGetChatServersRaw(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::message::GetChatServersRes>* PrepareAsyncGetChatServersRaw(::grpc::ClientContext* context, const ::message::GetChatServersReq& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetChatServer_;
+    const ::grpc::internal::RpcMethod rpcmethod_RegisterChatServer_;
+    const ::grpc::internal::RpcMethod rpcmethod_Heartbeat_;
+    const ::grpc::internal::RpcMethod rpcmethod_DeregisterChatServer_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetChatServers_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -363,6 +487,10 @@ class StatusService final {
     Service();
     virtual ~Service();
     virtual ::grpc::Status GetChatServer(::grpc::ServerContext* context, const ::message::GetStatusServiceReq* request, ::message::GetStatusServiceRes* response);
+    virtual ::grpc::Status RegisterChatServer(::grpc::ServerContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response);
+    virtual ::grpc::Status Heartbeat(::grpc::ServerContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response);
+    virtual ::grpc::Status DeregisterChatServer(::grpc::ServerContext* context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response);
+    virtual ::grpc::Status GetChatServers(::grpc::ServerContext* context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetChatServer : public BaseClass {
@@ -384,7 +512,87 @@ class StatusService final {
       ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetChatServer<Service > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRegisterChatServer(::grpc::ServerContext* context, ::message::ChatServerReq* request, ::grpc::ServerAsyncResponseWriter< ::message::ChatServerRes>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Heartbeat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Heartbeat() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_Heartbeat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Heartbeat(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHeartbeat(::grpc::ServerContext* context, ::message::ChatServerReq* request, ::grpc::ServerAsyncResponseWriter< ::message::ChatServerRes>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_DeregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_DeregisterChatServer() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_DeregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeregisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDeregisterChatServer(::grpc::ServerContext* context, ::message::ChatServerReq* request, ::grpc::ServerAsyncResponseWriter< ::message::ChatServerRes>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetChatServers() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_GetChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetChatServers(::grpc::ServerContext* /*context*/, const ::message::GetChatServersReq* /*request*/, ::message::GetChatServersRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetChatServers(::grpc::ServerContext* context, ::message::GetChatServersReq* request, ::grpc::ServerAsyncResponseWriter< ::message::GetChatServersRes>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GetChatServer<WithAsyncMethod_RegisterChatServer<WithAsyncMethod_Heartbeat<WithAsyncMethod_DeregisterChatServer<WithAsyncMethod_GetChatServers<Service > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_GetChatServer : public BaseClass {
    private:
@@ -432,11 +640,199 @@ class StatusService final {
     #endif
       { return nullptr; }
   };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_RegisterChatServer() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::message::ChatServerReq, ::message::ChatServerRes>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response) { return this->RegisterChatServer(context, request, response); }));}
+    void SetMessageAllocatorFor_RegisterChatServer(
+        ::grpc::experimental::MessageAllocator< ::message::ChatServerReq, ::message::ChatServerRes>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(1);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::message::ChatServerReq, ::message::ChatServerRes>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* RegisterChatServer(
+      ::grpc::CallbackServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* RegisterChatServer(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_Heartbeat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_Heartbeat() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::message::ChatServerReq, ::message::ChatServerRes>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response) { return this->Heartbeat(context, request, response); }));}
+    void SetMessageAllocatorFor_Heartbeat(
+        ::grpc::experimental::MessageAllocator< ::message::ChatServerReq, ::message::ChatServerRes>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(2);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::message::ChatServerReq, ::message::ChatServerRes>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_Heartbeat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Heartbeat(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* Heartbeat(
+      ::grpc::CallbackServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* Heartbeat(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_DeregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_DeregisterChatServer() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::message::ChatServerReq, ::message::ChatServerRes>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::message::ChatServerReq* request, ::message::ChatServerRes* response) { return this->DeregisterChatServer(context, request, response); }));}
+    void SetMessageAllocatorFor_DeregisterChatServer(
+        ::grpc::experimental::MessageAllocator< ::message::ChatServerReq, ::message::ChatServerRes>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(3);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::message::ChatServerReq, ::message::ChatServerRes>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_DeregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeregisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* DeregisterChatServer(
+      ::grpc::CallbackServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* DeregisterChatServer(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_GetChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_GetChatServers() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::message::GetChatServersReq, ::message::GetChatServersRes>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::message::GetChatServersReq* request, ::message::GetChatServersRes* response) { return this->GetChatServers(context, request, response); }));}
+    void SetMessageAllocatorFor_GetChatServers(
+        ::grpc::experimental::MessageAllocator< ::message::GetChatServersReq, ::message::GetChatServersRes>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(4);
+    #endif
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::message::GetChatServersReq, ::message::GetChatServersRes>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_GetChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetChatServers(::grpc::ServerContext* /*context*/, const ::message::GetChatServersReq* /*request*/, ::message::GetChatServersRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetChatServers(
+      ::grpc::CallbackServerContext* /*context*/, const ::message::GetChatServersReq* /*request*/, ::message::GetChatServersRes* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetChatServers(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::message::GetChatServersReq* /*request*/, ::message::GetChatServersRes* /*response*/)
+    #endif
+      { return nullptr; }
+  };
   #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_GetChatServer<Service > CallbackService;
+  typedef ExperimentalWithCallbackMethod_GetChatServer<ExperimentalWithCallbackMethod_RegisterChatServer<ExperimentalWithCallbackMethod_Heartbeat<ExperimentalWithCallbackMethod_DeregisterChatServer<ExperimentalWithCallbackMethod_GetChatServers<Service > > > > > CallbackService;
   #endif
 
-  typedef ExperimentalWithCallbackMethod_GetChatServer<Service > ExperimentalCallbackService;
+  typedef ExperimentalWithCallbackMethod_GetChatServer<ExperimentalWithCallbackMethod_RegisterChatServer<ExperimentalWithCallbackMethod_Heartbeat<ExperimentalWithCallbackMethod_DeregisterChatServer<ExperimentalWithCallbackMethod_GetChatServers<Service > > > > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetChatServer : public BaseClass {
    private:
@@ -455,6 +851,74 @@ class StatusService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Heartbeat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Heartbeat() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_Heartbeat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Heartbeat(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_DeregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_DeregisterChatServer() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_DeregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeregisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetChatServers() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_GetChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetChatServers(::grpc::ServerContext* /*context*/, const ::message::GetChatServersReq* /*request*/, ::message::GetChatServersRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GetChatServer : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -475,6 +939,86 @@ class StatusService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestRegisterChatServer(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Heartbeat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Heartbeat() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_Heartbeat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Heartbeat(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestHeartbeat(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_DeregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_DeregisterChatServer() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_DeregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeregisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDeregisterChatServer(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetChatServers() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_GetChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetChatServers(::grpc::ServerContext* /*context*/, const ::message::GetChatServersReq* /*request*/, ::message::GetChatServersRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetChatServers(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_GetChatServer : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -513,6 +1057,158 @@ class StatusService final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_RegisterChatServer() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->RegisterChatServer(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* RegisterChatServer(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* RegisterChatServer(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_Heartbeat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_Heartbeat() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Heartbeat(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_Heartbeat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Heartbeat(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* Heartbeat(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* Heartbeat(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_DeregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_DeregisterChatServer() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->DeregisterChatServer(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_DeregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeregisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* DeregisterChatServer(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* DeregisterChatServer(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_GetChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_GetChatServers() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetChatServers(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_GetChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetChatServers(::grpc::ServerContext* /*context*/, const ::message::GetChatServersReq* /*request*/, ::message::GetChatServersRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetChatServers(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetChatServers(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetChatServer : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -539,9 +1235,117 @@ class StatusService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedGetChatServer(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::message::GetStatusServiceReq,::message::GetStatusServiceRes>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_GetChatServer<Service > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_RegisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_RegisterChatServer() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::message::ChatServerReq, ::message::ChatServerRes>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::message::ChatServerReq, ::message::ChatServerRes>* streamer) {
+                       return this->StreamedRegisterChatServer(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_RegisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status RegisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedRegisterChatServer(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::message::ChatServerReq,::message::ChatServerRes>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Heartbeat : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Heartbeat() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::message::ChatServerReq, ::message::ChatServerRes>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::message::ChatServerReq, ::message::ChatServerRes>* streamer) {
+                       return this->StreamedHeartbeat(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Heartbeat() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Heartbeat(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedHeartbeat(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::message::ChatServerReq,::message::ChatServerRes>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_DeregisterChatServer : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_DeregisterChatServer() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::message::ChatServerReq, ::message::ChatServerRes>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::message::ChatServerReq, ::message::ChatServerRes>* streamer) {
+                       return this->StreamedDeregisterChatServer(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_DeregisterChatServer() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status DeregisterChatServer(::grpc::ServerContext* /*context*/, const ::message::ChatServerReq* /*request*/, ::message::ChatServerRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedDeregisterChatServer(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::message::ChatServerReq,::message::ChatServerRes>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetChatServers : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetChatServers() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::message::GetChatServersReq, ::message::GetChatServersRes>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::message::GetChatServersReq, ::message::GetChatServersRes>* streamer) {
+                       return this->StreamedGetChatServers(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetChatServers() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetChatServers(::grpc::ServerContext* /*context*/, const ::message::GetChatServersReq* /*request*/, ::message::GetChatServersRes* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetChatServers(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::message::GetChatServersReq,::message::GetChatServersRes>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_GetChatServer<WithStreamedUnaryMethod_RegisterChatServer<WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_DeregisterChatServer<WithStreamedUnaryMethod_GetChatServers<Service > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GetChatServer<Service > StreamedService;
+  typedef WithStreamedUnaryMethod_GetChatServer<WithStreamedUnaryMethod_RegisterChatServer<WithStreamedUnaryMethod_Heartbeat<WithStreamedUnaryMethod_DeregisterChatServer<WithStreamedUnaryMethod_GetChatServers<Service > > > > > StreamedService;
 };
 
 }  // namespace message
@@ -0,0 +1,182 @@
+#include "AsyncStatusServer.h"
+#include <algorithm>
+#include <iostream>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+
+class CallBase
+{
+public:
+	virtual ~CallBase() = default;
+	virtual void Proceed(bool ok) = 0;
+};
+
+//one outstanding rpc slot: waits for a request, runs the handler inline on the queue's
+//thread and puts a fresh slot back, so a queue never serves more than its slots at once
+template<class Req, class Res>
+class UnaryCall : public CallBase
+{
+public:
+	using RequestFn = void (StatusService::AsyncService::*)(grpc::ServerContext*, Req*,
+		grpc::ServerAsyncResponseWriter<Res>*, grpc::CompletionQueue*, grpc::ServerCompletionQueue*, void*);
+	using HandleFn = Status(StatusServerImpl::*)(ServerContext*, const Req*, Res*);
+
+	UnaryCall(StatusService::AsyncService* service, grpc::ServerCompletionQueue* cq, StatusServerImpl* impl, RequestFn request, HandleFn handle,
+		const atomic<bool>* shuttingDown)
+		:service_(service), cq_(cq), impl_(impl), request_(request), handle_(handle), shuttingDown_(shuttingDown), responder_(&ctx_), finished_(false)
+	{
+		(service_->*request_)(&ctx_, &req_, &responder_, cq_, cq_, this);
+	}
+
+	void Proceed(bool ok) override
+	{
+		//!ok before finishing means the server is shutting down
+		if (finished_ || !ok)
+		{
+			delete this;
+			return;
+		}
+		//no new slot once shutdown began, the queue may already be shut down
+		if (!shuttingDown_->load()) new UnaryCall(service_, cq_, impl_, request_, handle_, shuttingDown_);
+		Status status = (impl_->*handle_)(&ctx_, &req_, &res_);
+		finished_ = true;
+		responder_.Finish(res_, status, this);
+	}
+private:
+	StatusService::AsyncService* service_;
+	grpc::ServerCompletionQueue* cq_;
+	StatusServerImpl* impl_;
+	RequestFn request_;
+	HandleFn handle_;
+	const atomic<bool>* shuttingDown_;
+	grpc::ServerContext ctx_;
+	Req req_;
+	Res res_;
+	grpc::ServerAsyncResponseWriter<Res> responder_;
+	bool finished_;
+};
+
+template<class Req, class Res>
+static void Spawn(StatusService::AsyncService* service, grpc::ServerCompletionQueue* cq, StatusServerImpl* impl,
+	typename UnaryCall<Req, Res>::RequestFn request, typename UnaryCall<Req, Res>::HandleFn handle, const atomic<bool>* shuttingDown)
+{
+	new UnaryCall<Req, Res>(service, cq, impl, request, handle, shuttingDown);
+}
+
+//the index-th cpu the process may run on, queues beyond the cpu count wrap around
+static void PinThread(size_t index)
+{
+#ifdef _WIN32
+	DWORD_PTR process = 0, system = 0;
+	if (!GetProcessAffinityMask(GetCurrentProcess(), &process, &system) || !process) return;
+	size_t count = 0;
+	for (DWORD_PTR mask = process; mask; mask &= mask - 1) ++count;
+	size_t target = index % count;
+	for (size_t cpu = 0; cpu < sizeof(DWORD_PTR) * 8; ++cpu)
+	{
+		if (!(process & (DWORD_PTR(1) << cpu)) || target-- != 0) continue;
+		SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+		return;
+	}
+#else
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || CPU_COUNT(&allowed) == 0) return;
+	size_t target = index % CPU_COUNT(&allowed);
+	for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+	{
+		if (!CPU_ISSET(cpu, &allowed) || target-- != 0) continue;
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+		return;
+	}
+#endif
+}
+
+AsyncStatusServer::AsyncStatusServer(StatusServerImpl& impl)
+	:impl_(impl)
+{
+}
+
+AsyncStatusServer::~AsyncStatusServer()
+{
+	Shutdown();
+}
+
+bool AsyncStatusServer::Start(const std::string& address, int threads, int callsPerQueue)
+{
+	if (threads <= 0) threads = max(1u, thread::hardware_concurrency());
+	if (callsPerQueue <= 0) callsPerQueue = 1;
+
+	grpc::ServerBuilder builder;
+	builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+	builder.RegisterService(&service_);
+	for (int i = 0; i < threads; ++i)
+	{
+		cqs_.push_back(builder.AddCompletionQueue());
+	}
+	server_ = builder.BuildAndStart();
+	if (!server_) return false;
+
+	for (auto& cq : cqs_)
+	{
+		for (int i = 0; i < callsPerQueue; ++i)
+		{
+			Spawn<GetStatusServiceReq, GetStatusServiceRes>(&service_, cq.get(), &impl_,
+				&StatusService::AsyncService::RequestGetChatServer, &StatusServerImpl::GetChatServer, &shuttingDown_);
+			Spawn<ChatServerReq, ChatServerRes>(&service_, cq.get(), &impl_,
+				&StatusService::AsyncService::RequestRegisterChatServer, &StatusServerImpl::RegisterChatServer, &shuttingDown_);
+			Spawn<ChatServerReq, ChatServerRes>(&service_, cq.get(), &impl_,
+				&StatusService::AsyncService::RequestHeartbeat, &StatusServerImpl::Heartbeat, &shuttingDown_);
+			Spawn<ChatServerReq, ChatServerRes>(&service_, cq.get(), &impl_,
+				&StatusService::AsyncService::RequestDeregisterChatServer, &StatusServerImpl::DeregisterChatServer, &shuttingDown_);
+			Spawn<GetChatServersReq, GetChatServersRes>(&service_, cq.get(), &impl_,
+				&StatusService::AsyncService::RequestGetChatServers, &StatusServerImpl::GetChatServers, &shuttingDown_);
+		}
+	}
+	for (size_t i = 0; i < cqs_.size(); ++i)
+	{
+		threads_.emplace_back(&AsyncStatusServer::Poll, this, i);
+	}
+	return true;
+}
+
+void AsyncStatusServer::Shutdown()
+{
+	if (!server_) return;
+	shuttingDown_ = true;
+	server_->Shutdown();
+	//queues are shut down after the server so pending slots come back with !ok and free themselves
+	for (auto& cq : cqs_)
+	{
+		cq->Shutdown();
+	}
+	for (auto& t : threads_)
+	{
+		if (t.joinable()) t.join();
+	}
+	threads_.clear();
+	server_.reset();
+	cqs_.clear();
+	shuttingDown_ = false;
+}
+
+void AsyncStatusServer::Poll(size_t index)
+{
+	PinThread(index);
+	auto& cq = cqs_[index];
+	void* tag = nullptr;
+	bool ok = false;
+	while (cq->Next(&tag, &ok))
+	{
+		static_cast<CallBase*>(tag)->Proceed(ok);
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "StatusServerImpl.h"
+
+//serves StatusService on the async api: one completion queue per core, each drained by
+//a thread pinned to that core, the rpc logic itself stays in StatusServerImpl
+class AsyncStatusServer
+{
+public:
+	explicit AsyncStatusServer(StatusServerImpl& impl);
+	~AsyncStatusServer();
+
+	//threads: 0 means one per core, callsPerQueue: rpcs a queue serves at once per method
+	bool Start(const std::string& address, int threads, int callsPerQueue);
+	void Shutdown();
+private:
+	void Poll(size_t index);
+
+	StatusServerImpl& impl_;
+	StatusService::AsyncService service_;
+	std::unique_ptr<grpc::Server> server_;
+	std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> cqs_;
+	std::vector<std::thread> threads_;
+	//set before the server shuts down, finished calls stop putting new slots back
+	std::atomic<bool> shuttingDown_{ false };
+};
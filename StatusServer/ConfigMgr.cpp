@@ -0,0 +1,16 @@
+#include "ConfigMgr.h"
+#include <iostream>
+#include <boost/property_tree/ini_parser.hpp>
+
+ConfigMgr::ConfigMgr()
+{
+	try
+	{
+		boost::property_tree::ini_parser::read_ini("config.ini", tree_);
+	}
+	catch (boost::property_tree::ini_parser_error& e)
+	{
+		//TODO use log to print
+		std::cerr << "Load config.ini failed, use defaults: " << e.what() << std::endl;
+	}
+}
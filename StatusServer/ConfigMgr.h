@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+#include <boost/property_tree/ptree.hpp>
+#include "Singleton.ipp"
+
+//settings from config.ini next to the executable, keys are "Section.Key"
+class ConfigMgr : public Singleton<ConfigMgr>
+{
+	friend class Singleton<ConfigMgr>;
+public:
+	template<class T>
+	T Get(const std::string& path, const T& def) const
+	{
+		return tree_.get<T>(path, def);
+	}
+private:
+	ConfigMgr();
+	boost::property_tree::ptree tree_;
+};
@@ -12,4 +12,9 @@ enum ErrorCodes
 	PasswordUpFailed = 1008,  //ʧ
 	PasswordInvalid = 1009,   //ʧ
 	RPCGetFailed = 1010,  //ȡRPCʧ
+	RedisErr = 1011,  //Redisʧ
+	NoChatServer = 1012,  //ûпõ
+	ChatServerNotFound = 1013,  //δע
+	ServerBusy = 1014,  //æ
+	TooManyRequests = 1015,  //Ƶ
 };
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+//bounded multi producer queue, every cell carries a sequence number (Vyukov)
+//push never blocks: it fails when the queue is full
+template<class T>
+class LockFreeQueue
+{
+public:
+	explicit LockFreeQueue(size_t capacity)
+		:mask_(RoundUp(capacity) - 1),
+		cells_(new Cell[mask_ + 1]),
+		head_(0),
+		tail_(0)
+	{
+		for (size_t i = 0; i <= mask_; ++i)
+		{
+			cells_[i].seq.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	LockFreeQueue(const LockFreeQueue&) = delete;
+	LockFreeQueue& operator= (const LockFreeQueue&) = delete;
+
+	bool push(T value)
+	{
+		size_t pos = tail_.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Cell& cell = cells_[pos & mask_];
+			size_t seq = cell.seq.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+			if (diff == 0)
+			{
+				if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			}
+			else if (diff < 0) return false;
+			else pos = tail_.load(std::memory_order_relaxed);
+		}
+		Cell& cell = cells_[pos & mask_];
+		cell.value = std::move(value);
+		cell.seq.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(T& value)
+	{
+		size_t pos = head_.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Cell& cell = cells_[pos & mask_];
+			size_t seq = cell.seq.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+			if (diff == 0)
+			{
+				if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			}
+			else if (diff < 0) return false;
+			else pos = head_.load(std::memory_order_relaxed);
+		}
+		Cell& cell = cells_[pos & mask_];
+		value = std::move(cell.value);
+		cell.seq.store(pos + mask_ + 1, std::memory_order_release);
+		return true;
+	}
+
+	size_t capacity() const { return mask_ + 1; }
+private:
+	struct Cell
+	{
+		std::atomic<size_t> seq;
+		T value;
+	};
+
+	static size_t RoundUp(size_t n)
+	{
+		size_t size = 2;
+		while (size < n) size <<= 1;
+		return size;
+	}
+
+	const size_t mask_;
+	std::unique_ptr<Cell[]> cells_;
+	alignas(64) std::atomic<size_t> head_;
+	alignas(64) std::atomic<size_t> tail_;
+};
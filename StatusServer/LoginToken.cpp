@@ -0,0 +1,187 @@
+#include "LoginToken.h"
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+//shipped in an early config.ini, public since then
+static const char SampleSecret[] = "dev-only-change-me";
+
+static const char Base64Url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+static string Encode(const unsigned char* data, size_t len)
+{
+	string out;
+	out.reserve((len * 4 + 2) / 3);
+	uint32_t bits = 0;
+	int count = 0;
+	for (size_t i = 0; i < len; ++i)
+	{
+		bits = (bits << 8) | data[i];
+		count += 8;
+		while (count >= 6)
+		{
+			count -= 6;
+			out.push_back(Base64Url[(bits >> count) & 0x3f]);
+		}
+	}
+	if (count > 0) out.push_back(Base64Url[(bits << (6 - count)) & 0x3f]);
+	return out;
+}
+
+static bool Mac(const string& secret, const string& payload, unsigned char out[EVP_MAX_MD_SIZE], unsigned int& len)
+{
+	return HMAC(EVP_sha256(), secret.data(), (int)secret.size(),
+		reinterpret_cast<const unsigned char*>(payload.data()), payload.size(), out, &len) != nullptr;
+}
+
+static vector<string> Split(const string& str, char sep)
+{
+	vector<string> parts;
+	size_t start = 0;
+	for (;;)
+	{
+		size_t pos = str.find(sep, start);
+		parts.push_back(str.substr(start, pos - start));
+		if (pos == string::npos) return parts;
+		start = pos + 1;
+	}
+}
+
+void TokenKeyRing::Add(uint32_t id, const std::string& secret)
+{
+	lock_guard<mutex> lock(mutex_);
+	auto keys = make_shared<Keys>(*Snapshot());
+	keys->secrets[id] = secret;
+	if (keys->secrets.size() == 1) keys->current = id;
+	atomic_store(&keys_, shared_ptr<const Keys>(move(keys)));
+}
+
+void TokenKeyRing::Remove(uint32_t id)
+{
+	lock_guard<mutex> lock(mutex_);
+	auto keys = make_shared<Keys>(*Snapshot());
+	keys->secrets.erase(id);
+	atomic_store(&keys_, shared_ptr<const Keys>(move(keys)));
+}
+
+bool TokenKeyRing::Use(uint32_t id)
+{
+	lock_guard<mutex> lock(mutex_);
+	auto keys = make_shared<Keys>(*Snapshot());
+	if (!keys->secrets.count(id)) return false;
+	keys->current = id;
+	atomic_store(&keys_, shared_ptr<const Keys>(move(keys)));
+	return true;
+}
+
+bool TokenKeyRing::Load(const std::string& list)
+{
+	auto keys = make_shared<Keys>();
+	bool first = true;
+	for (auto& entry : Split(list, ','))
+	{
+		size_t colon = entry.find(':');
+		if (colon == string::npos || colon + 1 == entry.size()) return false;
+		uint32_t id = 0;
+		try
+		{
+			id = (uint32_t)stoul(entry.substr(0, colon));
+		}
+		catch (exception&)
+		{
+			return false;
+		}
+		string secret = entry.substr(colon + 1);
+		if (secret.size() < MinSecretSize || secret == SampleSecret) return false;
+		keys->secrets[id] = secret;
+		if (first) keys->current = id;
+		first = false;
+	}
+	if (keys->secrets.empty()) return false;
+	lock_guard<mutex> lock(mutex_);
+	atomic_store(&keys_, shared_ptr<const Keys>(move(keys)));
+	return true;
+}
+
+std::shared_ptr<const TokenKeyRing::Keys> TokenKeyRing::Snapshot() const
+{
+	return atomic_load(&keys_);
+}
+
+std::string TokenKeyRing::Sign(const TokenClaims& claims) const
+{
+	auto keys = Snapshot();
+	auto it = keys->secrets.find(keys->current);
+	if (it == keys->secrets.end()) return "";
+	ostringstream payload;
+	payload << it->first << '.' << claims.uid << '.' << claims.expire << '.' << claims.server << '.' << claims.nonce;
+	string token = payload.str();
+	unsigned char mac[EVP_MAX_MD_SIZE];
+	unsigned int len = 0;
+	if (!Mac(it->second, token, mac, len)) return "";
+	return token + "." + Encode(mac, len);
+}
+
+bool TokenKeyRing::Verify(const std::string& token, TokenClaims& claims, long long now) const
+{
+	size_t dot = token.rfind('.');
+	if (dot == string::npos) return false;
+	string payload = token.substr(0, dot);
+	vector<string> parts = Split(payload, '.');
+	//host may be an ipv4 address with dots of its own
+	if (parts.size() < 5) return false;
+	auto keys = Snapshot();
+	TokenClaims parsed;
+	uint32_t id = 0;
+	try
+	{
+		id = (uint32_t)stoul(parts.front());
+		parsed.uid = stoi(parts[1]);
+		parsed.expire = stoll(parts[2]);
+	}
+	catch (exception&)
+	{
+		return false;
+	}
+	auto it = keys->secrets.find(id);
+	if (it == keys->secrets.end()) return false;
+
+	unsigned char mac[EVP_MAX_MD_SIZE];
+	unsigned int len = 0;
+	if (!Mac(it->second, payload, mac, len)) return false;
+	string expected = Encode(mac, len);
+	string actual = token.substr(dot + 1);
+	if (expected.size() != actual.size() || CRYPTO_memcmp(expected.data(), actual.data(), expected.size()) != 0) return false;
+	if (parsed.expire < now) return false;
+
+	parsed.nonce = parts.back();
+	size_t begin = parts[0].size() + parts[1].size() + parts[2].size() + 3;
+	parsed.server = payload.substr(begin, payload.size() - begin - parsed.nonce.size() - 1);
+	claims = move(parsed);
+	return true;
+}
+
+//openssl keeps a drbg per thread, seeded once, so this costs no syscall
+string CreatNonce()
+{
+	static const char hex[] = "0123456789abcdef";
+	uint8_t bytes[8] = {};
+	if (RAND_bytes(bytes, sizeof(bytes)) != 1)
+	{
+		//TODO use log to print
+		cerr << "RAND_bytes failed, the nonce is not random" << endl;
+	}
+	string nonce;
+	for (uint8_t b : bytes)
+	{
+		nonce.push_back(hex[b >> 4]);
+		nonce.push_back(hex[b & 0x0f]);
+	}
+	return nonce;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+//login tokens signed with HMAC-SHA256, checked by the chat server without a round trip:
+//  <key id>.<uid>.<expire>.<host:port>.<nonce>.<base64url mac>
+//only depends on OpenSSL so chat servers can compile LoginToken.cpp in as is
+struct TokenClaims
+{
+	int uid = 0;
+	std::string server; //host:port the token was issued for
+	long long expire = 0; //unix seconds
+	std::string nonce;
+};
+
+//16 random hex digits that make every token unique
+std::string CreatNonce();
+
+//keys are looked up by id, so a new key can be rolled out everywhere before it signs anything
+//and the old one kept until its tokens expired
+class TokenKeyRing
+{
+public:
+	void Add(uint32_t id, const std::string& secret);
+	void Remove(uint32_t id);
+	//key used for new tokens, must have been added
+	bool Use(uint32_t id);
+	//"id:secret,id:secret", the first one signs. Fails when a secret is shorter than
+	//MinSecretSize or is the old sample value, nothing is loaded then
+	bool Load(const std::string& keys);
+
+	static constexpr size_t MinSecretSize = 32;
+
+	std::string Sign(const TokenClaims& claims) const;
+	bool Verify(const std::string& token, TokenClaims& claims, long long now) const;
+private:
+	struct Keys
+	{
+		std::map<uint32_t, std::string> secrets;
+		uint32_t current = 0;
+	};
+
+	std::shared_ptr<const Keys> Snapshot() const;
+
+	std::shared_ptr<const Keys> keys_ = std::make_shared<const Keys>();
+	std::mutex mutex_;
+};
@@ -0,0 +1,20 @@
+#pragma once
+#include <memory>
+#include <mutex>
+
+template<class T>
+class Singleton
+{
+public:
+	static T& Instance() {
+		static T instance;
+		return instance;
+	}
+
+	Singleton(T&&) = delete;
+	Singleton(const T&) = delete;
+	void operator= (const T&) = delete;
+protected:
+	Singleton() = default;
+	virtual ~Singleton() = default;
+};
\ No newline at end of file
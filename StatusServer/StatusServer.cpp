@@ -4,29 +4,47 @@
 #include <boost/asio.hpp>
 #include <grpcpp/grpcpp.h>
 #include "StatusServerImpl.h"
+#include "AsyncStatusServer.h"
+#include "ConfigMgr.h"
+
+//chat servers heartbeat every few seconds, sweep for the ones that went quiet
+static void ExpireLoop(boost::asio::steady_timer& timer, StatusServerImpl& service)
+{
+	timer.expires_after(std::chrono::seconds(1));
+	timer.async_wait([&timer, &service](boost::system::error_code ec) {
+		if (ec) return;
+		service.ExpireServers();
+		ExpireLoop(timer, service);
+		});
+}
 
 int main()
 {
 	try
 	{
 		StatusServerImpl service;
-		grpc::ServerBuilder builder;
-		//TODO use config to load host
-		builder.AddListeningPort("127.0.0.1:10087", grpc::InsecureServerCredentials());
-		builder.RegisterService(&service);
-		std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+		AsyncStatusServer server(service);
+		auto& config = ConfigMgr::Instance();
+		std::string address = config.Get<std::string>("Server.Address", "127.0.0.1:10087");
+		if (!server.Start(address, config.Get<int>("Server.Threads", 0), config.Get<int>("Server.CallsPerQueue", 64)))
+		{
+			std::cout << "Listen on " << address << " failed" << std::endl;
+			return -1;
+		}
 		//Debug
-		std::cout << "Running on 127.0.0.1:10087\n";
+		std::cout << "Running on " << address << "\n";
 
 		boost::asio::io_context ioc;
 		boost::asio::signal_set signals(ioc, SIGINT, SIGTERM);
-		signals.async_wait([&server](boost::system::error_code ec, int signal) {
-			server->Shutdown();
+		boost::asio::steady_timer expire(ioc);
+		signals.async_wait([&server, &expire](boost::system::error_code ec, int signal) {
+			expire.cancel();
+			server.Shutdown();
 			});
+		ExpireLoop(expire, service);
 
-		std::thread([&ioc] { ioc.run(); }).detach();
-		server->Wait();
-		ioc.stop();
+		//runs until the signal handler cancels the timer
+		ioc.run();
 	}
 	catch (std::exception& e)
 	{
@@ -1,34 +1,320 @@
 #include "StatusServerImpl.h"
 #include "ErrorCodes.h"
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
+#include "ConfigMgr.h"
+#include "Tracer.h"
 #include <string>
+#include <sstream>
+#include <random>
+#include <algorithm>
+#include <openssl/crypto.h>
 
 using namespace std;
 
-static string CreatUUID()
+static long long NowMs()
+{
+	return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//FNV-1a with a murmur finalizer, same on every StatusServer so a uid keeps its node
+static uint64_t Hash(const string& str)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned char c : str)
+	{
+		hash ^= c;
+		hash *= 1099511628211ULL;
+	}
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+//murmur finalizer over the pair, spreads consecutive uids across the servers
+static uint64_t Score(uint64_t server, int uid)
+{
+	uint64_t hash = server ^ ((uint64_t)(uint32_t)uid * 0x9e3779b97f4a7c15ULL);
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+//traceparent sent by the gate, unsampled when missing
+static TraceContext Incoming(ServerContext* context)
+{
+	auto& metadata = context->client_metadata();
+	auto it = metadata.find("traceparent");
+	if (it == metadata.end()) return TraceContext();
+	return Tracer::Parse(string(it->second.data(), it->second.size()));
+}
+
+//chat servers send [ChatServers] Secret as chat-secret metadata, without one nobody may register
+static Status Authorize(ServerContext* context, const string& secret)
+{
+	if (secret.empty()) return Status(grpc::StatusCode::PERMISSION_DENIED, "chat server registration is disabled");
+	auto& metadata = context->client_metadata();
+	auto it = metadata.find("chat-secret");
+	if (it == metadata.end() || it->second.size() != secret.size()
+		|| CRYPTO_memcmp(it->second.data(), secret.data(), secret.size()) != 0)
+	{
+		return Status(grpc::StatusCode::UNAUTHENTICATED, "bad chat server secret");
+	}
+	return Status::OK;
+}
+
+ChatServer::ChatServer(const std::string& host, const std::string& port)
+	:host(host), port(port), id(Hash(host + ":" + port))
 {
-	boost::uuids::uuid uuid = boost::uuids::random_generator()();
-	return boost::uuids::to_string(uuid);
 }
 
 StatusServerImpl::StatusServerImpl()
-	:index_(0)
+	:servers_(make_shared<const ServerList>()),
+	routing_(Routing::LeastLoad)
 {
-	//For Debug
-	servers_.emplace_back(ChatServer{ "127.0.0.1", "9001" });
+	auto& config = ConfigMgr::Instance();
+	if (config.Get<string>("Routing.Mode", "least_load") == "sticky") routing_ = Routing::Sticky;
+	spillFactor_ = max(1.0, config.Get<double>("Routing.SpillFactor", 1.25));
+	tokenTTL_ = chrono::seconds(config.Get<int>("Token.TTL", 60));
+	chatSecret_ = config.Get<string>("ChatServers.Secret", "");
+	//host:port separated by ',', served until chat servers register themselves and never expired
+	auto servers = make_shared<ServerList>();
+	stringstream seeds(config.Get<string>("ChatServers.Servers", ""));
+	string seed;
+	while (getline(seeds, seed, ','))
+	{
+		seed.erase(0, seed.find_first_not_of(' '));
+		seed.erase(seed.find_last_not_of(' ') + 1);
+		size_t colon = seed.find(':');
+		if (colon == string::npos) continue;
+		auto server = make_shared<ChatServer>(seed.substr(0, colon), seed.substr(colon + 1));
+		server->seeded = true;
+		servers->push_back(server);
+	}
+	servers_ = move(servers);
+	//a guessable key lets anyone forge login tokens, better not to start at all
+	if (!tokenKeys_.Load(config.Get<string>("Token.Keys", "")))
+	{
+		throw runtime_error("Token.Keys is missing, malformed or has a secret shorter than "
+			+ to_string(TokenKeyRing::MinSecretSize) + " bytes");
+	}
 }
 
 Status StatusServerImpl::GetChatServer(ServerContext* context, const GetStatusServiceReq *req, GetStatusServiceRes* res)
 {
+	ScopedSpan span(Incoming(context), "StatusService/GetChatServer", SpanKind::Server);
 	//Debug
 	cout << "receive uid: " << req->uid() << endl;
-	auto& server = servers_[index_++];
-	if (index_ >= servers_.size()) index_ = 0;
-	res->set_host(server.host);
-	res->set_port(server.port);
+	AssignServer(req->uid(), res);
+	return Status::OK;
+}
+
+Status StatusServerImpl::RegisterChatServer(ServerContext* context, const ChatServerReq* req, ChatServerRes* res)
+{
+	Status status = Authorize(context, chatSecret_);
+	if (!status.ok()) return status;
+	lock_guard<mutex> lock(mutex_);
+	//a restarted node registers again with the same address
+	shared_ptr<ChatServer> server = FindServer(req->host(), req->port());
+	bool added = !server;
+	if (added) server = make_shared<ChatServer>(req->host(), req->port());
+	ReportLoad(*server, req);
+	if (added)
+	{
+		auto servers = make_shared<ServerList>(*Servers());
+		servers->push_back(server);
+		atomic_store(&servers_, shared_ptr<const ServerList>(move(servers)));
+	}
+	//Debug
+	cout << "chat server registered: " << req->host() << ":" << req->port() << endl;
 	res->set_error(ErrorCodes::SUCCESS);
-	res->set_token(CreatUUID());
 	return Status::OK;
 }
+
+Status StatusServerImpl::Heartbeat(ServerContext* context, const ChatServerReq* req, ChatServerRes* res)
+{
+	Status status = Authorize(context, chatSecret_);
+	if (!status.ok()) return status;
+	shared_ptr<ChatServer> server = FindServer(req->host(), req->port());
+	if (!server)
+	{
+		//expired or never registered, the chat server registers again
+		res->set_error(ErrorCodes::ChatServerNotFound);
+		return Status::OK;
+	}
+	ReportLoad(*server, req);
+	res->set_error(ErrorCodes::SUCCESS);
+	return Status::OK;
+}
+
+Status StatusServerImpl::DeregisterChatServer(ServerContext* context, const ChatServerReq* req, ChatServerRes* res)
+{
+	Status status = Authorize(context, chatSecret_);
+	if (!status.ok()) return status;
+	lock_guard<mutex> lock(mutex_);
+	auto servers = make_shared<ServerList>(*Servers());
+	auto it = remove_if(servers->begin(), servers->end(), [req](const shared_ptr<ChatServer>& server) {
+		return server->host == req->host() && server->port == req->port();
+		});
+	if (it == servers->end())
+	{
+		res->set_error(ErrorCodes::ChatServerNotFound);
+		return Status::OK;
+	}
+	servers->erase(it, servers->end());
+	atomic_store(&servers_, shared_ptr<const ServerList>(move(servers)));
+	//Debug
+	cout << "chat server deregistered: " << req->host() << ":" << req->port() << endl;
+	res->set_error(ErrorCodes::SUCCESS);
+	return Status::OK;
+}
+
+Status StatusServerImpl::GetChatServers(ServerContext* context, const GetChatServersReq* req, GetChatServersRes* res)
+{
+	ScopedSpan span(Incoming(context), "StatusService/GetChatServers", SpanKind::Server);
+	//Debug
+	cout << "receive uids: " << req->uids_size() << endl;
+	if (Servers()->empty())
+	{
+		res->set_error(ErrorCodes::NoChatServer);
+		return Status::OK;
+	}
+	res->mutable_servers()->Reserve(req->uids_size());
+	//one at a time, every pick sees the connections the earlier ones added
+	for (int uid : req->uids())
+	{
+		AssignServer(uid, res->add_servers());
+	}
+	res->set_error(ErrorCodes::SUCCESS);
+	return Status::OK;
+}
+
+void StatusServerImpl::ExpireServers()
+{
+	long long now = NowMs();
+	long long deadline = now - chrono::duration_cast<chrono::milliseconds>(HeartbeatTimeout).count();
+	long long missed = now - chrono::duration_cast<chrono::milliseconds>(MissedBeat).count();
+	auto current = Servers();
+	//a server that missed a beat gets no new logins until its next heartbeat
+	for (auto& server : *current)
+	{
+		if (!server->seeded && server->lastBeat < missed) server->healthy = false;
+	}
+	auto expired = [deadline](const shared_ptr<ChatServer>& server) { return !server->seeded && server->lastBeat < deadline; };
+	//common case: everyone is alive and nothing gets copied
+	if (none_of(current->begin(), current->end(), expired)) return;
+
+	lock_guard<mutex> lock(mutex_);
+	auto servers = make_shared<ServerList>(*Servers());
+	for (auto& server : *servers)
+	{
+		//Debug
+		if (expired(server)) cout << "chat server expired: " << server->host << ":" << server->port << endl;
+	}
+	servers->erase(remove_if(servers->begin(), servers->end(), expired), servers->end());
+	atomic_store(&servers_, shared_ptr<const ServerList>(move(servers)));
+}
+
+void StatusServerImpl::ReportLoad(ChatServer& server, const ChatServerReq* req)
+{
+	server.connections = req->connections();
+	server.cpu = req->cpu();
+	server.queue = req->queue();
+	server.lastBeat = NowMs();
+	server.healthy = true;
+}
+
+shared_ptr<const StatusServerImpl::ServerList> StatusServerImpl::Servers() const
+{
+	return atomic_load(&servers_);
+}
+
+//power of two choices: the less loaded of two random healthy servers
+shared_ptr<ChatServer> StatusServerImpl::SelectServer()
+{
+	auto servers = Servers();
+	if (servers->empty()) return nullptr;
+	thread_local minstd_rand rng(random_device{}());
+	shared_ptr<ChatServer> best;
+	for (int i = 0; i < 2; ++i)
+	{
+		const shared_ptr<ChatServer>& candidate = (*servers)[rng() % servers->size()];
+		if (!candidate->healthy) continue;
+		if (!best || candidate->Load() < best->Load()) best = candidate;
+	}
+	if (best) return best;
+	//both samples were down, look at every server
+	for (auto& server : *servers)
+	{
+		if (server->healthy && (!best || server->Load() < best->Load())) best = server;
+	}
+	return best;
+}
+
+//rendezvous hashing: the uid ranks every healthy server and takes the best one that is not
+//overloaded, so reconnects land on the same node and a membership change only moves the
+//uids of the server that came or went
+shared_ptr<ChatServer> StatusServerImpl::StickyServer(int uid)
+{
+	auto servers = Servers();
+	long long total = 0;
+	int healthy = 0;
+	for (auto& server : *servers)
+	{
+		if (!server->healthy) continue;
+		total += server->Load();
+		++healthy;
+	}
+	if (!healthy) return nullptr;
+	//bounded load, the least loaded server is below it so something is picked
+	double bound = spillFactor_ * (total + 1) / healthy;
+	shared_ptr<ChatServer> best;
+	uint64_t bestScore = 0;
+	for (auto& server : *servers)
+	{
+		if (!server->healthy || server->Load() >= bound) continue;
+		uint64_t score = Score(server->id, uid);
+		if (!best || score > bestScore)
+		{
+			best = server;
+			bestScore = score;
+		}
+	}
+	//loads moved between the two passes
+	if (!best) return SelectServer();
+	return best;
+}
+
+shared_ptr<ChatServer> StatusServerImpl::FindServer(const std::string& host, const std::string& port)
+{
+	auto servers = Servers();
+	for (auto& server : *servers)
+	{
+		if (server->host == host && server->port == port) return server;
+	}
+	return nullptr;
+}
+
+void StatusServerImpl::AssignServer(int uid, GetStatusServiceRes* res)
+{
+	shared_ptr<ChatServer> server = routing_ == Routing::Sticky ? StickyServer(uid) : SelectServer();
+	if (!server)
+	{
+		res->set_error(ErrorCodes::NoChatServer);
+		return;
+	}
+	//counts until the next report corrects it, keeps bursts from piling on one node
+	++server->connections;
+	res->set_host(server->host);
+	res->set_port(server->port);
+	res->set_error(ErrorCodes::SUCCESS);
+	//signed, the chat server checks it with the shared key and needs no lookup
+	TokenClaims claims;
+	claims.uid = uid;
+	claims.server = server->host + ":" + server->port;
+	claims.expire = chrono::duration_cast<chrono::seconds>(chrono::system_clock::now().time_since_epoch() + tokenTTL_).count();
+	claims.nonce = CreatNonce();
+	res->set_token(tokenKeys_.Sign(claims));
+}
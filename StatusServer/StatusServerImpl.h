@@ -1,6 +1,12 @@
 #pragma once
 #include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "message.grpc.pb.h"
+#include "LoginToken.h"
 
 using grpc::Server;
 using grpc::ServerContext;
@@ -8,11 +14,32 @@ using grpc::Status;
 using message::StatusService;
 using message::GetStatusServiceReq;
 using message::GetStatusServiceRes;
+using message::ChatServerReq;
+using message::ChatServerRes;
+using message::GetChatServersReq;
+using message::GetChatServersRes;
 
 struct ChatServer
 {
+	ChatServer(const std::string& host, const std::string& port);
+	//lower is better, combines the last load report with logins handed out since
+	int Load() const { return connections + queue * 2 + cpu; }
+
 	std::string host;
 	std::string port;
+	uint64_t id; //hash of host:port, ranks the server in sticky routing
+	std::atomic<int> connections{ 0 };
+	std::atomic<int> cpu{ 0 }; //percent
+	std::atomic<int> queue{ 0 }; //pending messages
+	std::atomic<bool> healthy{ true };
+	std::atomic<long long> lastBeat{ 0 }; //steady clock, ms
+	bool seeded = false; //listed in [ChatServers], kept without heartbeats
+};
+
+enum class Routing
+{
+	LeastLoad,
+	Sticky,
 };
 
 class StatusServerImpl : public StatusService::Service
@@ -20,8 +47,33 @@ class StatusServerImpl : public StatusService::Service
 public:
 	StatusServerImpl();
 	Status GetChatServer(ServerContext* context, const GetStatusServiceReq *req, GetStatusServiceRes* res) override;
+	Status RegisterChatServer(ServerContext* context, const ChatServerReq* req, ChatServerRes* res) override;
+	Status Heartbeat(ServerContext* context, const ChatServerReq* req, ChatServerRes* res) override;
+	Status DeregisterChatServer(ServerContext* context, const ChatServerReq* req, ChatServerRes* res) override;
+	//one entry per uid in request order, each placed as GetChatServer would place it
+	Status GetChatServers(ServerContext* context, const GetChatServersReq* req, GetChatServersRes* res) override;
+	//marks servers unhealthy after MissedBeat and drops them after HeartbeatTimeout, seeded ones stay, called periodically
+	void ExpireServers();
+
+	static constexpr std::chrono::seconds MissedBeat{ 5 };
+	static constexpr std::chrono::seconds HeartbeatTimeout{ 10 };
 private:
-	std::vector<ChatServer> servers_;
-	int index_;
-};
+	using ServerList = std::vector<std::shared_ptr<ChatServer>>;
 
+	//readers load the current snapshot without locking, writers copy it under mutex_ and swap
+	std::shared_ptr<const ServerList> Servers() const;
+	std::shared_ptr<ChatServer> SelectServer();
+	std::shared_ptr<ChatServer> StickyServer(int uid);
+	std::shared_ptr<ChatServer> FindServer(const std::string& host, const std::string& port);
+	void AssignServer(int uid, GetStatusServiceRes* res);
+	//live load from a register or heartbeat, replaces the estimate kept since the last report
+	void ReportLoad(ChatServer& server, const ChatServerReq* req);
+
+	std::shared_ptr<const ServerList> servers_;
+	std::mutex mutex_;
+	Routing routing_;
+	double spillFactor_;
+	TokenKeyRing tokenKeys_;
+	std::chrono::seconds tokenTTL_;
+	std::string chatSecret_;
+};
@@ -47,7 +47,7 @@ struct TableStruct_message_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[8]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -55,6 +55,18 @@ struct TableStruct_message_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_message_2eproto;
 namespace message {
+class ChatServerReq;
+class ChatServerReqDefaultTypeInternal;
+extern ChatServerReqDefaultTypeInternal _ChatServerReq_default_instance_;
+class ChatServerRes;
+class ChatServerResDefaultTypeInternal;
+extern ChatServerResDefaultTypeInternal _ChatServerRes_default_instance_;
+class GetChatServersReq;
+class GetChatServersReqDefaultTypeInternal;
+extern GetChatServersReqDefaultTypeInternal _GetChatServersReq_default_instance_;
+class GetChatServersRes;
+class GetChatServersResDefaultTypeInternal;
+extern GetChatServersResDefaultTypeInternal _GetChatServersRes_default_instance_;
 class GetStatusServiceReq;
 class GetStatusServiceReqDefaultTypeInternal;
 extern GetStatusServiceReqDefaultTypeInternal _GetStatusServiceReq_default_instance_;
@@ -69,6 +81,10 @@ class VarifyResDefaultTypeInternal;
 extern VarifyResDefaultTypeInternal _VarifyRes_default_instance_;
 }  // namespace message
 PROTOBUF_NAMESPACE_OPEN
+template<> ::message::ChatServerReq* Arena::CreateMaybeMessage<::message::ChatServerReq>(Arena*);
+template<> ::message::ChatServerRes* Arena::CreateMaybeMessage<::message::ChatServerRes>(Arena*);
+template<> ::message::GetChatServersReq* Arena::CreateMaybeMessage<::message::GetChatServersReq>(Arena*);
+template<> ::message::GetChatServersRes* Arena::CreateMaybeMessage<::message::GetChatServersRes>(Arena*);
 template<> ::message::GetStatusServiceReq* Arena::CreateMaybeMessage<::message::GetStatusServiceReq>(Arena*);
 template<> ::message::GetStatusServiceRes* Arena::CreateMaybeMessage<::message::GetStatusServiceRes>(Arena*);
 template<> ::message::VarifyReq* Arena::CreateMaybeMessage<::message::VarifyReq>(Arena*);
@@ -721,6 +737,646 @@ class GetStatusServiceRes PROTOBUF_FINAL :
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_message_2eproto;
 };
+// -------------------------------------------------------------------
+
+class ChatServerReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.ChatServerReq) */ {
+ public:
+  inline ChatServerReq() : ChatServerReq(nullptr) {}
+  virtual ~ChatServerReq();
+
+  ChatServerReq(const ChatServerReq& from);
+  ChatServerReq(ChatServerReq&& from) noexcept
+    : ChatServerReq() {
+    *this = ::std::move(from);
+  }
+
+  inline ChatServerReq& operator=(const ChatServerReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChatServerReq& operator=(ChatServerReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const ChatServerReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ChatServerReq* internal_default_instance() {
+    return reinterpret_cast<const ChatServerReq*>(
+               &_ChatServerReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ChatServerReq& a, ChatServerReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChatServerReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChatServerReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ChatServerReq* New() const final {
+    return CreateMaybeMessage<ChatServerReq>(nullptr);
+  }
+
+  ChatServerReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ChatServerReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ChatServerReq& from);
+  void MergeFrom(const ChatServerReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChatServerReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.ChatServerReq";
+  }
+  protected:
+  explicit ChatServerReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
+    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHostFieldNumber = 1,
+    kPortFieldNumber = 2,
+    kConnectionsFieldNumber = 3,
+    kCpuFieldNumber = 4,
+    kQueueFieldNumber = 5,
+  };
+  // string host = 1;
+  void clear_host();
+  const std::string& host() const;
+  void set_host(const std::string& value);
+  void set_host(std::string&& value);
+  void set_host(const char* value);
+  void set_host(const char* value, size_t size);
+  std::string* mutable_host();
+  std::string* release_host();
+  void set_allocated_host(std::string* host);
+  private:
+  const std::string& _internal_host() const;
+  void _internal_set_host(const std::string& value);
+  std::string* _internal_mutable_host();
+  public:
+
+  // string port = 2;
+  void clear_port();
+  const std::string& port() const;
+  void set_port(const std::string& value);
+  void set_port(std::string&& value);
+  void set_port(const char* value);
+  void set_port(const char* value, size_t size);
+  std::string* mutable_port();
+  std::string* release_port();
+  void set_allocated_port(std::string* port);
+  private:
+  const std::string& _internal_port() const;
+  void _internal_set_port(const std::string& value);
+  std::string* _internal_mutable_port();
+  public:
+
+  // int32 connections = 3;
+  void clear_connections();
+  ::PROTOBUF_NAMESPACE_ID::int32 connections() const;
+  void set_connections(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_connections() const;
+  void _internal_set_connections(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 cpu = 4;
+  void clear_cpu();
+  ::PROTOBUF_NAMESPACE_ID::int32 cpu() const;
+  void set_cpu(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_cpu() const;
+  void _internal_set_cpu(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 queue = 5;
+  void clear_queue();
+  ::PROTOBUF_NAMESPACE_ID::int32 queue() const;
+  void set_queue(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_queue() const;
+  void _internal_set_queue(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.ChatServerReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr host_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr port_;
+  ::PROTOBUF_NAMESPACE_ID::int32 connections_;
+  ::PROTOBUF_NAMESPACE_ID::int32 cpu_;
+  ::PROTOBUF_NAMESPACE_ID::int32 queue_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChatServerRes PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.ChatServerRes) */ {
+ public:
+  inline ChatServerRes() : ChatServerRes(nullptr) {}
+  virtual ~ChatServerRes();
+
+  ChatServerRes(const ChatServerRes& from);
+  ChatServerRes(ChatServerRes&& from) noexcept
+    : ChatServerRes() {
+    *this = ::std::move(from);
+  }
+
+  inline ChatServerRes& operator=(const ChatServerRes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChatServerRes& operator=(ChatServerRes&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const ChatServerRes& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const ChatServerRes* internal_default_instance() {
+    return reinterpret_cast<const ChatServerRes*>(
+               &_ChatServerRes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ChatServerRes& a, ChatServerRes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChatServerRes* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChatServerRes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ChatServerRes* New() const final {
+    return CreateMaybeMessage<ChatServerRes>(nullptr);
+  }
+
+  ChatServerRes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ChatServerRes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const ChatServerRes& from);
+  void MergeFrom(const ChatServerRes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChatServerRes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.ChatServerRes";
+  }
+  protected:
+  explicit ChatServerRes(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
+    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.ChatServerRes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetChatServersReq PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.GetChatServersReq) */ {
+ public:
+  inline GetChatServersReq() : GetChatServersReq(nullptr) {}
+  virtual ~GetChatServersReq();
+
+  GetChatServersReq(const GetChatServersReq& from);
+  GetChatServersReq(GetChatServersReq&& from) noexcept
+    : GetChatServersReq() {
+    *this = ::std::move(from);
+  }
+
+  inline GetChatServersReq& operator=(const GetChatServersReq& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetChatServersReq& operator=(GetChatServersReq&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetChatServersReq& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetChatServersReq* internal_default_instance() {
+    return reinterpret_cast<const GetChatServersReq*>(
+               &_GetChatServersReq_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(GetChatServersReq& a, GetChatServersReq& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetChatServersReq* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetChatServersReq* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetChatServersReq* New() const final {
+    return CreateMaybeMessage<GetChatServersReq>(nullptr);
+  }
+
+  GetChatServersReq* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetChatServersReq>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetChatServersReq& from);
+  void MergeFrom(const GetChatServersReq& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetChatServersReq* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.GetChatServersReq";
+  }
+  protected:
+  explicit GetChatServersReq(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
+    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUidsFieldNumber = 1,
+  };
+  // repeated int32 uids = 1;
+  int uids_size() const;
+  private:
+  int _internal_uids_size() const;
+  public:
+  void clear_uids();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_uids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      _internal_uids() const;
+  void _internal_add_uids(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      _internal_mutable_uids();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int32 uids(int index) const;
+  void set_uids(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
+  void add_uids(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+      uids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+      mutable_uids();
+
+  // @@protoc_insertion_point(class_scope:message.GetChatServersReq)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > uids_;
+  mutable std::atomic<int> _uids_cached_byte_size_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetChatServersRes PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:message.GetChatServersRes) */ {
+ public:
+  inline GetChatServersRes() : GetChatServersRes(nullptr) {}
+  virtual ~GetChatServersRes();
+
+  GetChatServersRes(const GetChatServersRes& from);
+  GetChatServersRes(GetChatServersRes&& from) noexcept
+    : GetChatServersRes() {
+    *this = ::std::move(from);
+  }
+
+  inline GetChatServersRes& operator=(const GetChatServersRes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetChatServersRes& operator=(GetChatServersRes&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetChatServersRes& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetChatServersRes* internal_default_instance() {
+    return reinterpret_cast<const GetChatServersRes*>(
+               &_GetChatServersRes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(GetChatServersRes& a, GetChatServersRes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetChatServersRes* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetChatServersRes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetChatServersRes* New() const final {
+    return CreateMaybeMessage<GetChatServersRes>(nullptr);
+  }
+
+  GetChatServersRes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetChatServersRes>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetChatServersRes& from);
+  void MergeFrom(const GetChatServersRes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetChatServersRes* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "message.GetChatServersRes";
+  }
+  protected:
+  explicit GetChatServersRes(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_message_2eproto);
+    return ::descriptor_table_message_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServersFieldNumber = 2,
+    kErrorFieldNumber = 1,
+  };
+  // repeated .message.GetStatusServiceRes servers = 2;
+  int servers_size() const;
+  private:
+  int _internal_servers_size() const;
+  public:
+  void clear_servers();
+  ::message::GetStatusServiceRes* mutable_servers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::GetStatusServiceRes >*
+      mutable_servers();
+  private:
+  const ::message::GetStatusServiceRes& _internal_servers(int index) const;
+  ::message::GetStatusServiceRes* _internal_add_servers();
+  public:
+  const ::message::GetStatusServiceRes& servers(int index) const;
+  ::message::GetStatusServiceRes* add_servers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::GetStatusServiceRes >&
+      servers() const;
+
+  // int32 error = 1;
+  void clear_error();
+  ::PROTOBUF_NAMESPACE_ID::int32 error() const;
+  void set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_error() const;
+  void _internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:message.GetChatServersRes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::GetStatusServiceRes > servers_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_message_2eproto;
+};
 // ===================================================================
 
 
@@ -1176,6 +1832,332 @@ inline void GetStatusServiceRes::set_allocated_token(std::string* token) {
   // @@protoc_insertion_point(field_set_allocated:message.GetStatusServiceRes.token)
 }
 
+// -------------------------------------------------------------------
+
+// ChatServerReq
+
+// string host = 1;
+inline void ChatServerReq::clear_host() {
+  host_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatServerReq::host() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerReq.host)
+  return _internal_host();
+}
+inline void ChatServerReq::set_host(const std::string& value) {
+  _internal_set_host(value);
+  // @@protoc_insertion_point(field_set:message.ChatServerReq.host)
+}
+inline std::string* ChatServerReq::mutable_host() {
+  // @@protoc_insertion_point(field_mutable:message.ChatServerReq.host)
+  return _internal_mutable_host();
+}
+inline const std::string& ChatServerReq::_internal_host() const {
+  return host_.Get();
+}
+inline void ChatServerReq::_internal_set_host(const std::string& value) {
+  
+  host_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatServerReq::set_host(std::string&& value) {
+  
+  host_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:message.ChatServerReq.host)
+}
+inline void ChatServerReq::set_host(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  host_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:message.ChatServerReq.host)
+}
+inline void ChatServerReq::set_host(const char* value,
+    size_t size) {
+  
+  host_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:message.ChatServerReq.host)
+}
+inline std::string* ChatServerReq::_internal_mutable_host() {
+  
+  return host_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatServerReq::release_host() {
+  // @@protoc_insertion_point(field_release:message.ChatServerReq.host)
+  return host_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatServerReq::set_allocated_host(std::string* host) {
+  if (host != nullptr) {
+    
+  } else {
+    
+  }
+  host_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), host,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:message.ChatServerReq.host)
+}
+
+// string port = 2;
+inline void ChatServerReq::clear_port() {
+  port_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& ChatServerReq::port() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerReq.port)
+  return _internal_port();
+}
+inline void ChatServerReq::set_port(const std::string& value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:message.ChatServerReq.port)
+}
+inline std::string* ChatServerReq::mutable_port() {
+  // @@protoc_insertion_point(field_mutable:message.ChatServerReq.port)
+  return _internal_mutable_port();
+}
+inline const std::string& ChatServerReq::_internal_port() const {
+  return port_.Get();
+}
+inline void ChatServerReq::_internal_set_port(const std::string& value) {
+  
+  port_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void ChatServerReq::set_port(std::string&& value) {
+  
+  port_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:message.ChatServerReq.port)
+}
+inline void ChatServerReq::set_port(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  port_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:message.ChatServerReq.port)
+}
+inline void ChatServerReq::set_port(const char* value,
+    size_t size) {
+  
+  port_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:message.ChatServerReq.port)
+}
+inline std::string* ChatServerReq::_internal_mutable_port() {
+  
+  return port_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* ChatServerReq::release_port() {
+  // @@protoc_insertion_point(field_release:message.ChatServerReq.port)
+  return port_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void ChatServerReq::set_allocated_port(std::string* port) {
+  if (port != nullptr) {
+    
+  } else {
+    
+  }
+  port_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), port,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:message.ChatServerReq.port)
+}
+
+// int32 connections = 3;
+inline void ChatServerReq::clear_connections() {
+  connections_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatServerReq::_internal_connections() const {
+  return connections_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatServerReq::connections() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerReq.connections)
+  return _internal_connections();
+}
+inline void ChatServerReq::_internal_set_connections(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  connections_ = value;
+}
+inline void ChatServerReq::set_connections(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_connections(value);
+  // @@protoc_insertion_point(field_set:message.ChatServerReq.connections)
+}
+
+// int32 cpu = 4;
+inline void ChatServerReq::clear_cpu() {
+  cpu_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatServerReq::_internal_cpu() const {
+  return cpu_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatServerReq::cpu() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerReq.cpu)
+  return _internal_cpu();
+}
+inline void ChatServerReq::_internal_set_cpu(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  cpu_ = value;
+}
+inline void ChatServerReq::set_cpu(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_cpu(value);
+  // @@protoc_insertion_point(field_set:message.ChatServerReq.cpu)
+}
+
+// int32 queue = 5;
+inline void ChatServerReq::clear_queue() {
+  queue_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatServerReq::_internal_queue() const {
+  return queue_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatServerReq::queue() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerReq.queue)
+  return _internal_queue();
+}
+inline void ChatServerReq::_internal_set_queue(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  queue_ = value;
+}
+inline void ChatServerReq::set_queue(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_queue(value);
+  // @@protoc_insertion_point(field_set:message.ChatServerReq.queue)
+}
+
+// -------------------------------------------------------------------
+
+// ChatServerRes
+
+// int32 error = 1;
+inline void ChatServerRes::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatServerRes::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 ChatServerRes::error() const {
+  // @@protoc_insertion_point(field_get:message.ChatServerRes.error)
+  return _internal_error();
+}
+inline void ChatServerRes::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void ChatServerRes::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.ChatServerRes.error)
+}
+
+// -------------------------------------------------------------------
+
+// GetChatServersReq
+
+// repeated int32 uids = 1;
+inline int GetChatServersReq::_internal_uids_size() const {
+  return uids_.size();
+}
+inline int GetChatServersReq::uids_size() const {
+  return _internal_uids_size();
+}
+inline void GetChatServersReq::clear_uids() {
+  uids_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GetChatServersReq::_internal_uids(int index) const {
+  return uids_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GetChatServersReq::uids(int index) const {
+  // @@protoc_insertion_point(field_get:message.GetChatServersReq.uids)
+  return _internal_uids(index);
+}
+inline void GetChatServersReq::set_uids(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
+  uids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:message.GetChatServersReq.uids)
+}
+inline void GetChatServersReq::_internal_add_uids(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  uids_.Add(value);
+}
+inline void GetChatServersReq::add_uids(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_add_uids(value);
+  // @@protoc_insertion_point(field_add:message.GetChatServersReq.uids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+GetChatServersReq::_internal_uids() const {
+  return uids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
+GetChatServersReq::uids() const {
+  // @@protoc_insertion_point(field_list:message.GetChatServersReq.uids)
+  return _internal_uids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+GetChatServersReq::_internal_mutable_uids() {
+  return &uids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
+GetChatServersReq::mutable_uids() {
+  // @@protoc_insertion_point(field_mutable_list:message.GetChatServersReq.uids)
+  return _internal_mutable_uids();
+}
+
+// -------------------------------------------------------------------
+
+// GetChatServersRes
+
+// int32 error = 1;
+inline void GetChatServersRes::clear_error() {
+  error_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GetChatServersRes::_internal_error() const {
+  return error_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 GetChatServersRes::error() const {
+  // @@protoc_insertion_point(field_get:message.GetChatServersRes.error)
+  return _internal_error();
+}
+inline void GetChatServersRes::_internal_set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  error_ = value;
+}
+inline void GetChatServersRes::set_error(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:message.GetChatServersRes.error)
+}
+
+// repeated .message.GetStatusServiceRes servers = 2;
+inline int GetChatServersRes::_internal_servers_size() const {
+  return servers_.size();
+}
+inline int GetChatServersRes::servers_size() const {
+  return _internal_servers_size();
+}
+inline void GetChatServersRes::clear_servers() {
+  servers_.Clear();
+}
+inline ::message::GetStatusServiceRes* GetChatServersRes::mutable_servers(int index) {
+  // @@protoc_insertion_point(field_mutable:message.GetChatServersRes.servers)
+  return servers_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::GetStatusServiceRes >*
+GetChatServersRes::mutable_servers() {
+  // @@protoc_insertion_point(field_mutable_list:message.GetChatServersRes.servers)
+  return &servers_;
+}
+inline const ::message::GetStatusServiceRes& GetChatServersRes::_internal_servers(int index) const {
+  return servers_.Get(index);
+}
+inline const ::message::GetStatusServiceRes& GetChatServersRes::servers(int index) const {
+  // @@protoc_insertion_point(field_get:message.GetChatServersRes.servers)
+  return _internal_servers(index);
+}
+inline ::message::GetStatusServiceRes* GetChatServersRes::_internal_add_servers() {
+  return servers_.Add();
+}
+inline ::message::GetStatusServiceRes* GetChatServersRes::add_servers() {
+  // @@protoc_insertion_point(field_add:message.GetChatServersRes.servers)
+  return _internal_add_servers();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::message::GetStatusServiceRes >&
+GetChatServersRes::servers() const {
+  // @@protoc_insertion_point(field_list:message.GetChatServersRes.servers)
+  return servers_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1185,6 +2167,14 @@ inline void GetStatusServiceRes::set_allocated_token(std::string* token) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 